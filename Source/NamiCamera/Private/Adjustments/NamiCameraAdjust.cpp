@@ -3,9 +3,18 @@
 #include "Adjustments/NamiCameraAdjust.h"
 #include "Components/NamiCameraComponent.h"
 #include "Core/LogNamiCamera.h"
-#include "GameFramework/Character.h"
-#include "GameFramework/CharacterMovementComponent.h"
-#include "GameFramework/PlayerController.h"
+#include "Core/NamiCameraEasing.h"
+#include "GameFramework/Pawn.h"
+
+namespace NamiCameraAdjust_Impl
+{
+	/** 事件是否在蓝图子类中实现（原生子类重写 _Implementation 不算，仍可直接调用） */
+	static bool IsImplementedInBlueprint(const UClass* Class, FName FunctionName)
+	{
+		const UFunction* Function = Class->FindFunctionByName(FunctionName);
+		return Function && Function->GetOuter() != UNamiCameraAdjust::StaticClass();
+	}
+}
 
 UNamiCameraAdjust::UNamiCameraAdjust()
 	: BlendInTime(0.3f)
@@ -31,6 +40,36 @@ void UNamiCameraAdjust::Initialize(UNamiCameraComponent* InOwnerComponent)
 	BlendTimer = 0.f;
 	ActiveTime = 0.f;
 	bInputInterrupted = false;
+
+	bBlueprintTick = NamiCameraAdjust_Impl::IsImplementedInBlueprint(GetClass(), GET_FUNCTION_NAME_CHECKED(UNamiCameraAdjust, Tick));
+	bBlueprintCalculateParams = NamiCameraAdjust_Impl::IsImplementedInBlueprint(GetClass(), GET_FUNCTION_NAME_CHECKED(UNamiCameraAdjust, CalculateAdjustParams));
+}
+
+void UNamiCameraAdjust::ResetForReuse()
+{
+	// 只恢复配置类属性：实例化子对象不能与类默认对象共享，蓝图事件图帧等内部属性不可覆盖
+	const UNamiCameraAdjust* Defaults = GetClass()->GetDefaultObject<UNamiCameraAdjust>();
+	for (TFieldIterator<FProperty> It(GetClass()); It; ++It)
+	{
+		const FProperty* Property = *It;
+		if (Property->HasAnyPropertyFlags(CPF_Edit | CPF_BlueprintVisible | CPF_BlueprintAssignable)
+			&& !Property->HasAnyPropertyFlags(CPF_InstancedReference | CPF_ContainsInstancedReference))
+		{
+			Property->CopyCompleteValue_InContainer(this, Defaults);
+		}
+	}
+
+	OwnerComponent.Reset();
+	State = ENamiCameraAdjustState::Inactive;
+	CurrentBlendWeight = 0.f;
+	BlendTimer = 0.f;
+	ActiveTime = 0.f;
+	CustomInputValue = 0.f;
+	bInputInterrupted = false;
+	bBlendOutSynced = false;
+	bUseStaticParams = false;
+	StaticParams = FNamiCameraAdjustParams();
+	++PoolSerial;
 }
 
 void UNamiCameraAdjust::OnActivate_Implementation()
@@ -61,7 +100,7 @@ FNamiCameraAdjustParams UNamiCameraAdjust::CalculateAdjustParams_Implementation(
 	return FNamiCameraAdjustParams();
 }
 
-FNamiCameraAdjustParams UNamiCameraAdjust::GetWeightedAdjustParams(float DeltaTime)
+FNamiCameraAdjustParams UNamiCameraAdjust::GetWeightedAdjustParams(float DeltaTime, const FNamiCameraInputSnapshot& Inputs)
 {
 	UpdateBlending(DeltaTime);
 
@@ -70,11 +109,19 @@ FNamiCameraAdjustParams UNamiCameraAdjust::GetWeightedAdjustParams(float DeltaTi
 		ActiveTime += DeltaTime;
 	}
 
-	Tick(DeltaTime);
+	// 蓝图未实现的事件直接调用原生实现，避免每帧 ProcessEvent
+	if (bBlueprintTick)
+	{
+		Tick(DeltaTime);
+	}
+	else
+	{
+		Tick_Implementation(DeltaTime);
+	}
 
-	FNamiCameraAdjustParams Params = CalculateAdjustParams(DeltaTime);
+	FNamiCameraAdjustParams Params = bBlueprintCalculateParams ? CalculateAdjustParams(DeltaTime) : CalculateAdjustParams_Implementation(DeltaTime);
 
-	ApplyCurveDrivenParams(Params);
+	ApplyCurveDrivenParams(Params, Inputs);
 
 	return Params.ScaleAdditiveParamsByWeight(CurrentBlendWeight);
 }
@@ -234,134 +281,57 @@ float UNamiCameraAdjust::CalculateBlendAlpha(float LinearAlpha) const
 {
 	switch (BlendType)
 	{
-	case ENamiCameraBlendType::Linear:
-		return LinearAlpha;
-
-	case ENamiCameraBlendType::EaseIn:
-		return FMath::InterpEaseIn(0.f, 1.f, LinearAlpha, 2.f);
-
-	case ENamiCameraBlendType::EaseOut:
-		return FMath::InterpEaseOut(0.f, 1.f, LinearAlpha, 2.f);
-
-	case ENamiCameraBlendType::EaseInOut:
-		return FMath::InterpEaseInOut(0.f, 1.f, LinearAlpha, 2.f);
-
 	case ENamiCameraBlendType::CustomCurve:
 		if (BlendCurve)
 		{
-			return BlendCurve->GetFloatValue(LinearAlpha);
+			return BlendCurveLUT.Evaluate(BlendCurve, LinearAlpha);
 		}
 		return LinearAlpha;
 
 	default:
-		return LinearAlpha;
-	}
-}
-
-float UNamiCameraAdjust::GetInputSourceValue(ENamiCameraAdjustInputSource Source) const
-{
-	switch (Source)
-	{
-	case ENamiCameraAdjustInputSource::None:
-		return 0.f;
-
-	case ENamiCameraAdjustInputSource::MoveSpeed:
-		{
-			UNamiCameraComponent* CameraComp = GetOwnerComponent();
-			if (!CameraComp)
-			{
-				return 0.f;
-			}
-
-			APawn* OwnerPawn = CameraComp->GetOwnerPawn();
-			if (!OwnerPawn)
-			{
-				return 0.f;
-			}
-
-			if (ACharacter* Character = Cast<ACharacter>(OwnerPawn))
-			{
-				if (UCharacterMovementComponent* MovementComp = Character->GetCharacterMovement())
-				{
-					return MovementComp->Velocity.Size();
-				}
-			}
-
-			return OwnerPawn->GetVelocity().Size();
-		}
-
-	case ENamiCameraAdjustInputSource::LookSpeed:
-		{
-			UNamiCameraComponent* CameraComp = GetOwnerComponent();
-			if (!CameraComp)
-			{
-				return 0.f;
-			}
-
-			APlayerController* PC = CameraComp->GetOwnerPlayerController();
-			if (!PC)
-			{
-				return 0.f;
-			}
-
-			float TurnInput = 0.f;
-			float LookInput = 0.f;
-			PC->GetInputMouseDelta(TurnInput, LookInput);
-
-			return FMath::Sqrt(TurnInput * TurnInput + LookInput * LookInput);
-		}
-
-	case ENamiCameraAdjustInputSource::Time:
-		return ActiveTime;
-
-	case ENamiCameraAdjustInputSource::Custom:
-		return CustomInputValue;
-
-	default:
-		return 0.f;
+		return FNamiCameraEasing::Ease(BlendType, LinearAlpha);
 	}
 }
 
-float UNamiCameraAdjust::EvaluateCurveBinding(const FNamiCameraAdjustCurveBinding& Binding) const
+float UNamiCameraAdjust::EvaluateCurveBinding(const FNamiCameraAdjustCurveBinding& Binding, const FNamiCameraInputSnapshot& Inputs) const
 {
 	if (!Binding.IsValid())
 	{
 		return Binding.OutputOffset;
 	}
 
-	float InputValue = GetInputSourceValue(Binding.InputSource);
-	return Binding.Evaluate(InputValue);
+	return Binding.Evaluate(Inputs, ActiveTime, CustomInputValue);
 }
 
-void UNamiCameraAdjust::ApplyCurveDrivenParams(FNamiCameraAdjustParams& OutParams) const
+void UNamiCameraAdjust::ApplyCurveDrivenParams(FNamiCameraAdjustParams& OutParams, const FNamiCameraInputSnapshot& Inputs) const
 {
 	if (CurveConfig.FOVBinding.IsValid())
 	{
-		OutParams.FOVOffset += EvaluateCurveBinding(CurveConfig.FOVBinding);
+		OutParams.FOVOffset += EvaluateCurveBinding(CurveConfig.FOVBinding, Inputs);
 		OutParams.MarkFOVModified();
 	}
 
 	if (CurveConfig.ArmLengthBinding.IsValid())
 	{
-		OutParams.TargetArmLengthOffset += EvaluateCurveBinding(CurveConfig.ArmLengthBinding);
+		OutParams.TargetArmLengthOffset += EvaluateCurveBinding(CurveConfig.ArmLengthBinding, Inputs);
 		OutParams.MarkTargetArmLengthModified();
 	}
 
 	if (CurveConfig.CameraOffsetXBinding.IsValid())
 	{
-		OutParams.CameraLocationOffset.X += EvaluateCurveBinding(CurveConfig.CameraOffsetXBinding);
+		OutParams.CameraLocationOffset.X += EvaluateCurveBinding(CurveConfig.CameraOffsetXBinding, Inputs);
 		OutParams.MarkCameraLocationOffsetModified();
 	}
 
 	if (CurveConfig.CameraOffsetYBinding.IsValid())
 	{
-		OutParams.CameraLocationOffset.Y += EvaluateCurveBinding(CurveConfig.CameraOffsetYBinding);
+		OutParams.CameraLocationOffset.Y += EvaluateCurveBinding(CurveConfig.CameraOffsetYBinding, Inputs);
 		OutParams.MarkCameraLocationOffsetModified();
 	}
 
 	if (CurveConfig.CameraOffsetZBinding.IsValid())
 	{
-		OutParams.CameraLocationOffset.Z += EvaluateCurveBinding(CurveConfig.CameraOffsetZBinding);
+		OutParams.CameraLocationOffset.Z += EvaluateCurveBinding(CurveConfig.CameraOffsetZBinding, Inputs);
 		OutParams.MarkCameraLocationOffsetModified();
 	}
 }
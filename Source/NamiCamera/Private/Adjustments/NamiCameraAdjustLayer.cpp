@@ -0,0 +1,152 @@
+// Copyright Qiu, Inc. All Rights Reserved.
+
+#include "Adjustments/NamiCameraAdjustLayer.h"
+#include "Core/NamiCameraEasing.h"
+
+void FNamiCameraAdjustLayer::Advance(float DeltaTime, const FNamiCameraInputSnapshot& Inputs)
+{
+	switch (State)
+	{
+	case ENamiCameraAdjustState::Inactive:
+		// 首次推进：进入混入，缓存 Override 臂旋转的世界目标
+		State = ENamiCameraAdjustState::BlendingIn;
+		BlendTimer = 0.f;
+		ActiveTime = 0.f;
+		CachedWorldArmRotationTarget = (Inputs.OwnerRotation + ArmRotationTarget).GetNormalized();
+		// 与 UNamiCameraAdjust 一致，激活当帧即推进混入
+		[[fallthrough]];
+
+	case ENamiCameraAdjustState::BlendingIn:
+		if (BlendInTime <= 0.f)
+		{
+			CurrentBlendWeight = 1.f;
+			State = ENamiCameraAdjustState::Active;
+		}
+		else
+		{
+			BlendTimer += DeltaTime;
+			const float LinearAlpha = FMath::Clamp(BlendTimer / BlendInTime, 0.f, 1.f);
+			CurrentBlendWeight = CalculateBlendAlpha(LinearAlpha);
+
+			if (LinearAlpha >= 1.f)
+			{
+				State = ENamiCameraAdjustState::Active;
+			}
+		}
+		break;
+
+	case ENamiCameraAdjustState::Active:
+		CurrentBlendWeight = 1.f;
+		break;
+
+	case ENamiCameraAdjustState::BlendingOut:
+		if (BlendOutTime <= 0.f)
+		{
+			CurrentBlendWeight = 0.f;
+			State = ENamiCameraAdjustState::Inactive;
+			bInputInterrupted = false;
+		}
+		else
+		{
+			BlendTimer -= DeltaTime;
+			const float LinearAlpha = FMath::Clamp(BlendTimer / BlendOutTime, 0.f, 1.f);
+			CurrentBlendWeight = CalculateBlendAlpha(LinearAlpha);
+
+			if (LinearAlpha <= 0.f)
+			{
+				State = ENamiCameraAdjustState::Inactive;
+				bInputInterrupted = false;
+			}
+		}
+		break;
+	}
+
+	if (State != ENamiCameraAdjustState::Inactive)
+	{
+		ActiveTime += DeltaTime;
+	}
+}
+
+FNamiCameraAdjustParams FNamiCameraAdjustLayer::GetWeightedParams(const FNamiCameraInputSnapshot& Inputs) const
+{
+	FNamiCameraAdjustParams Params = StaticParams;
+
+	// 与 UNamiCameraAdjust::ApplyCurveDrivenParams 一致
+	if (CurveConfig.FOVBinding.IsValid())
+	{
+		Params.FOVOffset += EvaluateCurveBinding(CurveConfig.FOVBinding, Inputs);
+		Params.MarkFOVModified();
+	}
+
+	if (CurveConfig.ArmLengthBinding.IsValid())
+	{
+		Params.TargetArmLengthOffset += EvaluateCurveBinding(CurveConfig.ArmLengthBinding, Inputs);
+		Params.MarkTargetArmLengthModified();
+	}
+
+	if (CurveConfig.CameraOffsetXBinding.IsValid())
+	{
+		Params.CameraLocationOffset.X += EvaluateCurveBinding(CurveConfig.CameraOffsetXBinding, Inputs);
+		Params.MarkCameraLocationOffsetModified();
+	}
+
+	if (CurveConfig.CameraOffsetYBinding.IsValid())
+	{
+		Params.CameraLocationOffset.Y += EvaluateCurveBinding(CurveConfig.CameraOffsetYBinding, Inputs);
+		Params.MarkCameraLocationOffsetModified();
+	}
+
+	if (CurveConfig.CameraOffsetZBinding.IsValid())
+	{
+		Params.CameraLocationOffset.Z += EvaluateCurveBinding(CurveConfig.CameraOffsetZBinding, Inputs);
+		Params.MarkCameraLocationOffsetModified();
+	}
+
+	return Params.ScaleAdditiveParamsByWeight(CurrentBlendWeight);
+}
+
+void FNamiCameraAdjustLayer::RequestDeactivate(bool bForceImmediate)
+{
+	if (State == ENamiCameraAdjustState::Inactive)
+	{
+		return;
+	}
+
+	if (bForceImmediate || BlendOutTime <= 0.f)
+	{
+		State = ENamiCameraAdjustState::Inactive;
+		CurrentBlendWeight = 0.f;
+		bInputInterrupted = false;
+	}
+	else
+	{
+		State = ENamiCameraAdjustState::BlendingOut;
+		BlendTimer = BlendOutTime * CurrentBlendWeight;
+		bBlendOutSynced = false;
+	}
+}
+
+void FNamiCameraAdjustLayer::TriggerInputInterrupt()
+{
+	if (!bInputInterrupted)
+	{
+		bInputInterrupted = true;
+		RequestDeactivate();
+		bBlendOutSynced = true;
+	}
+}
+
+float FNamiCameraAdjustLayer::CalculateBlendAlpha(float LinearAlpha) const
+{
+	if (BlendType == ENamiCameraBlendType::CustomCurve)
+	{
+		return BlendCurve ? BlendCurveLUT.Evaluate(BlendCurve, LinearAlpha) : LinearAlpha;
+	}
+	return FNamiCameraEasing::Ease(BlendType, LinearAlpha);
+}
+
+float FNamiCameraAdjustLayer::EvaluateCurveBinding(const FNamiCameraAdjustCurveBinding& Binding, const FNamiCameraInputSnapshot& Inputs) const
+{
+	// Custom 输入需要 UNamiCameraAdjust::SetCustomInput，轻量层按 0 处理；需要外部驱动时使用注册输入源
+	return Binding.Evaluate(Inputs, ActiveTime, 0.f);
+}
@@ -2,7 +2,7 @@
 
 #include "Animation/AnimNotifyState_CameraAdjust.h"
 
-#include "Adjustments/NamiCameraAdjust.h"
+#include "Adjustments/NamiCameraAdjustLayer.h"
 #include "Components/NamiCameraComponent.h"
 #include "Core/LogNamiCamera.h"
 #include "GameFramework/Pawn.h"
@@ -49,44 +49,38 @@ void UAnimNotifyState_CameraAdjust::NotifyBegin(USkeletalMeshComponent* MeshComp
 	// 
 	CachedCameraComponent = CameraComp;
 
-	// ʵ
-	UNamiCameraAdjust* Adjust = NewObject<UNamiCameraAdjust>(CameraComp);
-	if (!Adjust)
-	{
-		UE_LOG(LogNamiCamera, Error, TEXT("[AnimNotifyState_CameraAdjust] Failed to create CameraAdjust instance"));
-		return;
-	}
+	// ֻ֪ͨʹþ̬ͣ UObject
+	FNamiCameraAdjustLayer Layer;
 
 	// ûϲ
-	Adjust->BlendInTime = BlendInTime;
-	Adjust->BlendOutTime = BlendOutTime;
-	Adjust->BlendType = BlendType;
-	Adjust->Priority = Priority;
+	Layer.BlendInTime = BlendInTime;
+	Layer.BlendOutTime = BlendOutTime;
+	Layer.BlendType = BlendType;
+	Layer.Priority = Priority;
 
 	// Ʋ
-	Adjust->bAllowPlayerInput = bAllowPlayerInput;
-	Adjust->InputInterruptThreshold = InputInterruptThreshold;
+	Layer.bAllowPlayerInput = bAllowPlayerInput;
+	Layer.InputInterruptThreshold = InputInterruptThreshold;
 
 	//  ArmRotation Override ģʽñתĿֵ
 	if (ArmRotation.bEnabled && ArmRotation.BlendMode == ENamiCameraAdjustBlendMode::Override)
 	{
-		Adjust->ArmRotationTarget = ArmRotation.Value;
+		Layer.ArmRotationTarget = ArmRotation.Value;
 	}
 
 	// õ
-	FNamiCameraAdjustParams Params = BuildAdjustParams();
-	Adjust->SetStaticParams(Params);
+	Layer.StaticParams = BuildAdjustParams();
 
-	// ͵
-	if (CameraComp->PushAdjustInstance(Adjust))
+	// ͵
+	ActiveLayerId = CameraComp->PushAdjustLayer(Layer);
+	if (ActiveLayerId != INDEX_NONE)
 	{
-		ActiveAdjust = Adjust;
 		UE_LOG(LogNamiCamera, Log, TEXT("[AnimNotifyState_CameraAdjust] Started camera adjust for animation: %s"),
 			*GetNameSafe(Animation));
 	}
 	else
 	{
-		UE_LOG(LogNamiCamera, Warning, TEXT("[AnimNotifyState_CameraAdjust] Failed to push CameraAdjust instance"));
+		UE_LOG(LogNamiCamera, Warning, TEXT("[AnimNotifyState_CameraAdjust] Failed to push CameraAdjust layer"));
 	}
 }
 
@@ -101,18 +95,18 @@ void UAnimNotifyState_CameraAdjust::NotifyEnd(USkeletalMeshComponent* MeshComp,
 		return;
 	}
 
-	// ֹͣʼBlendOut
-	if (ActiveAdjust.IsValid())
+	// ֹͣ㣨ʼBlendOutḴãѱƳʱ PopAdjustLayer ֱӷ
+	if (ActiveLayerId != INDEX_NONE)
 	{
 		UNamiCameraComponent* CameraComp = CachedCameraComponent.Get();
 		if (CameraComp)
 		{
 			// ʹfalseBlendOutֹͣ
-			CameraComp->PopAdjust(ActiveAdjust.Get(), false);
+			CameraComp->PopAdjustLayer(ActiveLayerId, false);
 			UE_LOG(LogNamiCamera, Log, TEXT("[AnimNotifyState_CameraAdjust] Ended camera adjust for animation: %s"),
 				*GetNameSafe(Animation));
 		}
-		ActiveAdjust.Reset();
+		ActiveLayerId = INDEX_NONE;
 	}
 
 	CachedCameraComponent.Reset();
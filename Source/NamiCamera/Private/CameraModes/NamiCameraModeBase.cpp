@@ -4,12 +4,42 @@
 #include "Animation/BlendSpace.h"
 #include "Components/NamiCameraComponent.h"
 #include "Core/NamiCameraEnums.h"
+#include "Core/NamiCameraEasing.h"
 #include "ModeComponents/NamiCameraModeComponent.h"
 #include "GameFramework/Pawn.h"
 #include "Core/LogNamiCameraMacros.h"
+#include "Core/NamiCameraStats.h"
+#include "HAL/IConsoleManager.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(NamiCameraModeBase)
 
+namespace NamiCameraModeBase_Impl
+{
+	static int32 GReuseSettledView = -1;
+	static FAutoConsoleVariableRef CVarReuseSettledView(
+		TEXT("NamiCamera.Mode.ReuseSettledView"),
+		GReuseSettledView,
+		TEXT("输入未变且已稳定时沿用上一次模式视图。-1=跟随模式设置，0=关闭，1=开启"),
+		ECVF_Default);
+
+	/** 输入签名比较容差（cm / 度） */
+	static constexpr double InputTolerance = 0.01;
+
+	/** 连续多少帧输入与输出都不变后才开始沿用视图 */
+	static constexpr int32 SettleFrameThreshold = 2;
+
+	/** 前后两次输出是否一致 */
+	static bool IsViewUnchanged(const FNamiCameraView& A, const FNamiCameraView& B)
+	{
+		return A.CameraLocation.Equals(B.CameraLocation, 0.01)
+			&& A.PivotLocation.Equals(B.PivotLocation, 0.01)
+			&& A.ControlLocation.Equals(B.ControlLocation, 0.01)
+			&& A.CameraRotation.Equals(B.CameraRotation, 0.01)
+			&& A.ControlRotation.Equals(B.ControlRotation, 0.01)
+			&& FMath::IsNearlyEqual(A.FOV, B.FOV, 0.01f);
+	}
+}
+
 UNamiCameraModeBase::UNamiCameraModeBase(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 	, DefaultFOV(90.0f)
@@ -32,6 +62,22 @@ UNamiCameraModeBase::UNamiCameraModeBase(const FObjectInitializer& ObjectInitial
 void UNamiCameraModeBase::Initialize_Implementation(UNamiCameraComponent* InCameraComponent)
 {
 	CameraComponent = InCameraComponent;
+	ResetBlendState();
+
+	// 初始化所有组件
+	for (UNamiCameraModeComponent* Component : ModeComponents)
+	{
+		if (IsValid(Component))
+		{
+			Component->Initialize(this);
+		}
+	}
+
+	SortComponents();
+}
+
+void UNamiCameraModeBase::ResetBlendState()
+{
 	State = ENamiCameraModeState::Initialized;
 
 	// 同步 BlendConfig 到 BlendStack（保持与 EnhancedCameraSystem 兼容）
@@ -47,7 +93,7 @@ void UNamiCameraModeBase::Initialize_Implementation(UNamiCameraComponent* InCame
 	case ENamiCameraBlendType::EaseIn:
 	case ENamiCameraBlendType::EaseOut:
 	case ENamiCameraBlendType::EaseInOut:
-		// 暂时都使用 Linear，后续可以根据实际引擎版本的枚举值调整
+		// FAlphaBlend 只推进线性混合值，缓动在 UpdateBlending 中经 FNamiCameraEasing 施加（与调整器、效果组件一致）
 		BlendOption = EAlphaBlendOption::Linear;
 		break;
 	case ENamiCameraBlendType::CustomCurve:
@@ -68,22 +114,14 @@ void UNamiCameraModeBase::Initialize_Implementation(UNamiCameraComponent* InCame
 	// 设置混合范围：从 0.0 到 1.0（默认淡入）
 	CameraBlendAlpha.SetValueRange(0.0f, 1.0f);
 
-	// 初始化所有组件
-	for (UNamiCameraModeComponent* Component : ModeComponents)
-	{
-		if (IsValid(Component))
-		{
-			Component->Initialize(this);
-		}
-	}
-
-	SortComponents();
+	ResetSettledState();
 }
 
 void UNamiCameraModeBase::Activate_Implementation()
 {
 	State = ENamiCameraModeState::Active;
 	bIsActivated = true;
+	ResetSettledState();
 
 	// 激活所有组件
 	for (UNamiCameraModeComponent* Component : ModeComponents)
@@ -112,9 +150,31 @@ void UNamiCameraModeBase::Deactivate_Implementation()
 
 void UNamiCameraModeBase::Tick_Implementation(float DeltaTime)
 {
+	using namespace NamiCameraModeBase_Impl;
+
 	// 更新混合权重（使用 FAlphaBlend）
 	UpdateBlending(DeltaTime);
 
+	// 输入未变、输出已收敛、组件均已稳定：沿用上一次视图
+	const bool bReuseEnabled = ShouldReuseSettledView();
+	FNamiCameraModeInputSignature InputSignature;
+	if (bReuseEnabled)
+	{
+		GatherInputSignature(InputSignature);
+		const bool bInputUnchanged = InputSignature.Equals(LastInputSignature, InputTolerance);
+		if (bInputUnchanged
+			&& SettledFrames >= SettleFrameThreshold
+			&& ReusedViewFrames < MaxReusedViewFrames
+			&& AreComponentsSettled())
+		{
+			++ReusedViewFrames;
+			INC_DWORD_STAT(STAT_NamiCamera_ReusedModeViews);
+			return;
+		}
+	}
+	ReusedViewFrames = 0;
+	const FNamiCameraView PreviousView = CurrentView;
+
 	// 更新所有组件
 	UpdateComponents(DeltaTime);
 
@@ -123,6 +183,62 @@ void UNamiCameraModeBase::Tick_Implementation(float DeltaTime)
 
 	// 应用组件到视图
 	ApplyComponentsToView(CurrentView, DeltaTime);
+
+	if (bBlendInParameterSpace)
+	{
+		BuildCameraState(CurrentState);
+	}
+
+	if (bReuseEnabled)
+	{
+		const bool bSettled = InputSignature.Equals(LastInputSignature, InputTolerance) && IsViewUnchanged(CurrentView, PreviousView);
+		SettledFrames = bSettled ? SettledFrames + 1 : 0;
+		LastInputSignature = MoveTemp(InputSignature);
+	}
+}
+
+void UNamiCameraModeBase::BuildCameraState(FNamiCameraState& OutState) const
+{
+	OutState.SetFromView(CurrentView);
+}
+
+void UNamiCameraModeBase::GatherInputSignature(FNamiCameraModeInputSignature& OutSignature) const
+{
+	if (!CameraComponent.IsValid())
+	{
+		return;
+	}
+	if (const APawn* OwnerPawn = CameraComponent->GetOwnerPawn())
+	{
+		OutSignature.Add(OwnerPawn->GetActorLocation());
+		OutSignature.Add(OwnerPawn->GetActorRotation());
+		OutSignature.Add(OwnerPawn->GetControlRotation());
+	}
+}
+
+bool UNamiCameraModeBase::ShouldReuseSettledView() const
+{
+	using namespace NamiCameraModeBase_Impl;
+	return GReuseSettledView >= 0 ? GReuseSettledView > 0 : bReuseSettledView;
+}
+
+bool UNamiCameraModeBase::AreComponentsSettled() const
+{
+	for (const UNamiCameraModeComponent* Component : ModeComponents)
+	{
+		if (Component && Component->IsEnabled() && !Component->IsSettled())
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void UNamiCameraModeBase::ResetSettledState()
+{
+	LastInputSignature.Reset();
+	SettledFrames = 0;
+	ReusedViewFrames = 0;
 }
 
 FNamiCameraView UNamiCameraModeBase::CalculateView_Implementation(float DeltaTime)
@@ -175,6 +291,7 @@ void UNamiCameraModeBase::AddComponent(UNamiCameraModeComponent* Component)
 
 	// 标记 ComponentMap 需要重建
 	bComponentMapDirty = true;
+	ResetSettledState();
 }
 
 void UNamiCameraModeBase::RemoveComponent(UNamiCameraModeComponent* Component)
@@ -197,6 +314,7 @@ void UNamiCameraModeBase::RemoveComponent(UNamiCameraModeComponent* Component)
 
 		// 标记 ComponentMap 需要重建
 		bComponentMapDirty = true;
+		ResetSettledState();
 	}
 }
 
@@ -279,6 +397,8 @@ void UNamiCameraModeBase::SetBlendWeight(float InWeight)
 
 void UNamiCameraModeBase::ApplyComponentsToView(FNamiCameraView& InOutView, float DeltaTime)
 {
+	NAMI_CAMERA_SCOPE_STAGE(ModeComponents);
+
 	// 优化：只遍历有效的组件，减少无效检查
 	for (UNamiCameraModeComponent* Component : ModeComponents)
 	{
@@ -293,12 +413,15 @@ void UNamiCameraModeBase::ApplyComponentsToView(FNamiCameraView& InOutView, floa
 			continue;
 		}
 
+		NAMI_CAMERA_SCOPE_OBJECT(Component);
 		Component->ApplyToView(InOutView, DeltaTime);
 	}
 }
 
 void UNamiCameraModeBase::UpdateComponents(float DeltaTime)
 {
+	NAMI_CAMERA_SCOPE_STAGE(ModeComponents);
+
 	// 优化：只遍历有效的组件，减少无效检查
 	for (UNamiCameraModeComponent* Component : ModeComponents)
 	{
@@ -313,6 +436,7 @@ void UNamiCameraModeBase::UpdateComponents(float DeltaTime)
 			continue;
 		}
 
+		NAMI_CAMERA_SCOPE_OBJECT(Component);
 		Component->Update(DeltaTime);
 	}
 }
@@ -344,11 +468,23 @@ void UNamiCameraModeBase::UpdateBlending(float DeltaTime)
 	float BlendedValue = CameraBlendAlpha.GetBlendedValue();
 
 	// 应用混合曲线（使用 BlendStack，与 EnhancedCameraSystem 保持一致）
-	BlendWeight = FAlphaBlend::AlphaToBlendOption(
-		BlendedValue,
-		BlendStack.BlendOption,
-		BlendStack.CustomCurve
-	);
+	// 自定义曲线与 FAlphaBlend 相同：将混合值映射到关键帧时间范围，经共享查找表求值
+	if (BlendStack.BlendOption == EAlphaBlendOption::Custom && BlendStack.CustomCurve)
+	{
+		BlendWeight = BlendCurveLUT.EvaluateNormalized(BlendStack.CustomCurve, BlendedValue);
+	}
+	else if (BlendStack.BlendOption == EAlphaBlendOption::Linear)
+	{
+		BlendWeight = FNamiCameraEasing::Ease(BlendConfig.BlendType, BlendedValue);
+	}
+	else
+	{
+		BlendWeight = FAlphaBlend::AlphaToBlendOption(
+			BlendedValue,
+			BlendStack.BlendOption,
+			BlendStack.CustomCurve
+		);
+	}
 
 	// 确保权重在有效范围内
 	BlendWeight = FMath::Clamp(BlendWeight, 0.0f, 1.0f);
@@ -7,6 +7,7 @@
 #include "Calculators/NamiCameraRotationCalculator.h"
 #include "Calculators/NamiCameraFOVCalculator.h"
 #include "Components/NamiCameraComponent.h"
+#include "Core/NamiCameraStats.h"
 #include "GameFramework/Pawn.h"
 #include "GameFramework/PlayerController.h"
 
@@ -105,6 +106,8 @@ void UNamiComposableCameraMode::Deactivate_Implementation()
 
 FNamiCameraView UNamiComposableCameraMode::CalculateView_Implementation(float DeltaTime)
 {
+	NAMI_CAMERA_SCOPE_STAGE(Calculators);
+
 	FNamiCameraView View;
 	View.FOV = DefaultFOV;
 
@@ -119,6 +122,7 @@ FNamiCameraView UNamiComposableCameraMode::CalculateView_Implementation(float De
 	FVector PivotLocation = FVector::ZeroVector;
 	if (TargetCalculator)
 	{
+		NAMI_CAMERA_SCOPE_OBJECT(TargetCalculator);
 		TargetCalculator->CalculateTargetLocation(DeltaTime, PivotLocation);
 	}
 	else if (UNamiCameraComponent* CameraComp = GetCameraComponent())
@@ -153,6 +157,7 @@ FNamiCameraView UNamiComposableCameraMode::CalculateView_Implementation(float De
 	// ========== 2. 位置计算器 → CameraLocation ==========
 	if (PositionCalculator)
 	{
+		NAMI_CAMERA_SCOPE_OBJECT(PositionCalculator);
 		CurrentCameraLocation = PositionCalculator->CalculateCameraPosition(PivotLocation, CachedControlRotation, DeltaTime);
 	}
 	else
@@ -165,6 +170,7 @@ FNamiCameraView UNamiComposableCameraMode::CalculateView_Implementation(float De
 	// ========== 3. 旋转计算器 → CameraRotation ==========
 	if (RotationCalculator)
 	{
+		NAMI_CAMERA_SCOPE_OBJECT(RotationCalculator);
 		CurrentCameraRotation = RotationCalculator->CalculateCameraRotation(
 			CurrentCameraLocation,
 			PivotLocation,
@@ -185,6 +191,7 @@ FNamiCameraView UNamiComposableCameraMode::CalculateView_Implementation(float De
 	// ========== 4. FOV 计算器 → FOV ==========
 	if (FOVCalculator)
 	{
+		NAMI_CAMERA_SCOPE_OBJECT(FOVCalculator);
 		View.FOV = FOVCalculator->CalculateFOV(CurrentCameraLocation, PivotLocation, DeltaTime);
 	}
 
@@ -203,6 +210,20 @@ void UNamiComposableCameraMode::SetPrimaryTarget(AActor* Target)
 	}
 }
 
+void UNamiComposableCameraMode::GatherInputSignature(FNamiCameraModeInputSignature& OutSignature) const
+{
+	Super::GatherInputSignature(OutSignature);
+
+	// 控制旋转可能来自没有 Pawn 的 PlayerController
+	OutSignature.Add(GetControlRotation());
+
+	if (const AActor* PrimaryTarget = GetPrimaryTarget())
+	{
+		OutSignature.Add(PrimaryTarget->GetActorLocation());
+		OutSignature.Add(PrimaryTarget->GetActorRotation());
+	}
+}
+
 AActor* UNamiComposableCameraMode::GetPrimaryTarget() const
 {
 	if (TargetCalculator)
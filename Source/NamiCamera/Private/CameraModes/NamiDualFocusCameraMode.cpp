@@ -8,7 +8,6 @@
 #include "Calculators/FOV/NamiFramingFOVCalculator.h"
 #include "ModeComponents/NamiCameraLockOnComponent.h"
 #include "Components/NamiCameraComponent.h"
-#include "GameFramework/PlayerController.h"
 #include "GameFramework/Pawn.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(NamiDualFocusCameraMode)
@@ -25,8 +24,27 @@ UNamiDualFocusCameraMode::UNamiDualFocusCameraMode()
 
 void UNamiDualFocusCameraMode::Initialize_Implementation(UNamiCameraComponent* InCameraComponent)
 {
-	// 先确保有计算器实例（CreateDefaultSubobject 在 NewObject 创建时不起作用）
 	// 必须在调用 Super 之前创建，这样 InitializeCalculators() 才能正确初始化它们
+	CreateRuntimeCalculators();
+
+	// 调用父类初始化（会调用 InitializeStrategies）
+	Super::Initialize_Implementation(InCameraComponent);
+
+	// 创建并注册 LockOn 组件
+	SetupLockOnComponent();
+
+	SyncLockOnProviderToCalculators();
+}
+
+void UNamiDualFocusCameraMode::Prewarm()
+{
+	Super::Prewarm();
+	CreateRuntimeCalculators();
+}
+
+void UNamiDualFocusCameraMode::CreateRuntimeCalculators()
+{
+	// 先确保有计算器实例（CreateDefaultSubobject 在 NewObject 创建时不起作用）
 	if (!TargetCalculator)
 	{
 		UNamiDualFocusTargetCalculator* DualFocusCalculator = NewObject<UNamiDualFocusTargetCalculator>(this);
@@ -58,14 +76,6 @@ void UNamiDualFocusCameraMode::Initialize_Implementation(UNamiCameraComponent* I
 		FramingFOV->bKeepBothInFrame = true;
 		FOVCalculator = FramingFOV;
 	}
-
-	// 调用父类初始化（会调用 InitializeStrategies）
-	Super::Initialize_Implementation(InCameraComponent);
-
-	// 创建并注册 LockOn 组件
-	SetupLockOnComponent();
-
-	SyncLockOnProviderToCalculators();
 }
 
 void UNamiDualFocusCameraMode::Activate_Implementation()
@@ -112,6 +122,31 @@ void UNamiDualFocusCameraMode::AddOrbitInput(float DeltaAngle)
 	{
 		EllipseCalculator->AddOrbitInput(DeltaAngle);
 	}
+
+	// 轨道输入不在输入签名中，下一帧必须重新计算
+	ResetSettledState();
+}
+
+void UNamiDualFocusCameraMode::GatherInputSignature(FNamiCameraModeInputSignature& OutSignature) const
+{
+	Super::GatherInputSignature(OutSignature);
+
+	if (HasValidLockedTarget())
+	{
+		OutSignature.Add(CachedLockOnProvider->GetLockedFocusLocation());
+	}
+
+	// 轨道输入在 CalculateView 中读取，与其一样取自组件本帧的输入快照
+	const UNamiEllipseOrbitPositionCalculator* EllipseCalculator = GetEllipseOrbitPositionCalculator();
+	if (EllipseCalculator && EllipseCalculator->bEnablePlayerInput)
+	{
+		if (const UNamiCameraComponent* CameraComp = GetCameraComponent())
+		{
+			float MouseDeltaX, MouseDeltaY;
+			CameraComp->GetInputMouseDelta(MouseDeltaX, MouseDeltaY);
+			OutSignature.Add(FVector(MouseDeltaX, MouseDeltaY, 0.0));
+		}
+	}
 }
 
 UNamiDualFocusTargetCalculator* UNamiDualFocusCameraMode::GetDualFocusTargetCalculator() const
@@ -239,15 +274,12 @@ void UNamiDualFocusCameraMode::ProcessPlayerInput(float DeltaTime)
 	{
 		if (EllipseCalculator->bEnablePlayerInput)
 		{
-			// 获取 PlayerController
-			if (UNamiCameraComponent* CameraComp = GetCameraComponent())
+			// 读取组件本帧输入快照的原始鼠标增量（回放时为录制值）；摇杆偏转逐帧累加会随帧率变化，不参与轨道输入
+			if (const UNamiCameraComponent* CameraComp = GetCameraComponent())
 			{
-				if (APlayerController* PC = CameraComp->GetOwnerPlayerController())
-				{
-					float MouseDeltaX, MouseDeltaY;
-					PC->GetInputMouseDelta(MouseDeltaX, MouseDeltaY);
-					EllipseCalculator->AddOrbitInput(MouseDeltaX);
-				}
+				float MouseDeltaX, MouseDeltaY;
+				CameraComp->GetInputMouseDelta(MouseDeltaX, MouseDeltaY);
+				EllipseCalculator->AddOrbitInput(MouseDeltaX);
 			}
 		}
 	}
@@ -20,8 +20,22 @@ UNamiThirdPersonCameraMode::UNamiThirdPersonCameraMode()
 
 void UNamiThirdPersonCameraMode::Initialize_Implementation(UNamiCameraComponent* InCameraComponent)
 {
-	// 先确保有计算器实例（CreateDefaultSubobject 在 NewObject 创建时不起作用）
 	// 必须在调用 Super 之前创建，这样 InitializeCalculators() 才能正确初始化它们
+	CreateRuntimeCalculators();
+
+	// 调用父类初始化（会调用 InitializeCalculators）
+	Super::Initialize_Implementation(InCameraComponent);
+}
+
+void UNamiThirdPersonCameraMode::Prewarm()
+{
+	Super::Prewarm();
+	CreateRuntimeCalculators();
+}
+
+void UNamiThirdPersonCameraMode::CreateRuntimeCalculators()
+{
+	// 先确保有计算器实例（CreateDefaultSubobject 在 NewObject 创建时不起作用）
 	if (!TargetCalculator)
 	{
 		TargetCalculator = NewObject<UNamiSingleTargetCalculator>(this);
@@ -43,9 +57,6 @@ void UNamiThirdPersonCameraMode::Initialize_Implementation(UNamiCameraComponent*
 		StaticFOV->BaseFOV = 90.0f;
 		FOVCalculator = StaticFOV;
 	}
-
-	// 调用父类初始化（会调用 InitializeCalculators）
-	Super::Initialize_Implementation(InCameraComponent);
 }
 
 UNamiCameraSpringArmComponent* UNamiThirdPersonCameraMode::GetSpringArmComponent() const
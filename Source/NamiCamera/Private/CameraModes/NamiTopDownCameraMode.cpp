@@ -17,9 +17,22 @@ UNamiTopDownCameraMode::UNamiTopDownCameraMode()
 
 void UNamiTopDownCameraMode::Initialize_Implementation(UNamiCameraComponent* InCameraComponent)
 {
-	// 先确保有计算器实例（CreateDefaultSubobject 在 NewObject 创建时不起作用）
 	// 必须在调用 Super 之前创建，这样 InitializeCalculators() 才能正确初始化它们
+	CreateRuntimeCalculators();
 
+	// 调用父类初始化（会调用 InitializeCalculators）
+	Super::Initialize_Implementation(InCameraComponent);
+}
+
+void UNamiTopDownCameraMode::Prewarm()
+{
+	Super::Prewarm();
+	CreateRuntimeCalculators();
+}
+
+void UNamiTopDownCameraMode::CreateRuntimeCalculators()
+{
+	// 先确保有计算器实例（CreateDefaultSubobject 在 NewObject 创建时不起作用）
 	if (!TargetCalculator)
 	{
 		TargetCalculator = NewObject<UNamiSingleTargetCalculator>(this);
@@ -46,9 +59,6 @@ void UNamiTopDownCameraMode::Initialize_Implementation(UNamiCameraComponent* InC
 		StaticFOV->BaseFOV = 80.0f;  // 略小于第三人称，提供更清晰的视野
 		FOVCalculator = StaticFOV;
 	}
-
-	// 调用父类初始化（会调用 InitializeCalculators）
-	Super::Initialize_Implementation(InCameraComponent);
 }
 
 UNamiTopDownPositionCalculator* UNamiTopDownCameraMode::GetTopDownPositionCalculator() const
@@ -18,27 +18,69 @@
 #include "DrawDebugHelpers.h"
 #include "Engine/World.h"
 #include "Core/NamiCameraDebugInfo.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectIterator.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Algo/BinarySearch.h"
+#include "Core/NamiCameraInputProvider.h"
+#include "EnhancedPlayerInput.h"
+#include "InputAction.h"
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// FNamiCameraModeHandle
 ///
-namespace CameraModeHandle_Impl
-{
-	static int32 LastHandleId = 0;
-	static int32 GetNextQueuedHandleIdForUse() { return ++LastHandleId; }
-}
-
 bool FNamiCameraModeHandle::IsValid() const
 {
-	return Owner.IsValid() && HandleId != 0;
+	const UNamiCameraComponent* OwnerComponent = Owner.Get();
+	return OwnerComponent && OwnerComponent->IsCameraModeHandleAlive(*this);
 }
 
 void FNamiCameraModeHandle::Reset()
 {
 	Owner.Reset();
 	HandleId = 0;
+	SlotIndex = INDEX_NONE;
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// 飞行记录器控制台命令
+///
+static FAutoConsoleCommandWithWorldAndArgs GNamiCameraFlightRecorderDumpCommand(
+	TEXT("NamiCamera.FlightRecorder.Dump"),
+	TEXT("将当前世界中所有 NamiCameraComponent 的飞行记录器写入 Saved/NamiCamera/FlightRecorder/"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		for (TObjectIterator<UNamiCameraComponent> It; It; ++It)
+		{
+			if (It->GetWorld() == World && !It->IsTemplate())
+			{
+				It->DumpFlightRecorder(Args.Num() > 0 ? Args[0] : TEXT("Manual"));
+			}
+		}
+	}));
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// 相机模式实例池控制台命令
+///
+static FAutoConsoleCommandWithWorld GNamiCameraPoolStatsCommand(
+	TEXT("NamiCamera.PoolStats"),
+	TEXT("打印当前世界中所有 NamiCameraComponent 的相机模式/调整器实例池命中/未命中统计"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		for (TObjectIterator<UNamiCameraComponent> It; It; ++It)
+		{
+			if (It->GetWorld() == World && !It->IsTemplate())
+			{
+				It->DumpCameraModePoolStats();
+				It->DumpAdjustPoolStats();
+			}
+		}
+	}));
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 ///	UNamiCameraComponent
 UNamiCameraComponent::UNamiCameraComponent(const FObjectInitializer &ObjectInitializer)
@@ -83,6 +125,20 @@ void UNamiCameraComponent::BeginPlay()
 	// 重置平滑混合层状态（确保每次 BeginPlay 时重新初始化）
 	bHasInitializedCurrentView = false;
 
+	// 初始化飞行记录器（预分配环形缓冲）
+	FlightRecorder.Initialize(bEnableFlightRecorder ? FlightRecorderCapacity : 0);
+
+	// 预加载并预热相机模式（组件列表 + 项目设置中的全局列表）
+	TArray<TSoftClassPtr<UNamiCameraModeBase>> ModesToPreload = PreloadCameraModes;
+	for (const TSoftClassPtr<UNamiCameraModeBase>& ModeClass : UNamiCameraSettings::GetPreloadCameraModes())
+	{
+		ModesToPreload.AddUnique(ModeClass);
+	}
+	if (ModesToPreload.Num() > 0)
+	{
+		PreloadCameraModeClasses(ModesToPreload);
+	}
+
 	// 检查并推送默认相机模式
 	if (IsValid(DefaultCameraMode))
 	{
@@ -95,25 +151,61 @@ void UNamiCameraComponent::BeginPlay()
 	}
 }
 
+void UNamiCameraComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// 取消未完成的预加载，避免回调落到已结束的组件上
+	for (const TSharedPtr<FStreamableHandle>& Handle : CameraModePreloadHandles)
+	{
+		if (Handle.IsValid())
+		{
+			Handle->CancelHandle();
+		}
+	}
+	CameraModePreloadHandles.Reset();
+	CameraModePoolStats.PendingLoads = 0;
+	AdjustPool.Reset();
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void UNamiCameraComponent::GetCameraView(float DeltaTime, FMinimalViewInfo &DesiredView)
 {
-	SCOPE_CYCLE_COUNTER(STAT_NamiCamera_GetCameraView);
+	NAMI_CAMERA_ALLOC_AUDIT_FRAME(this);
+	NAMI_CAMERA_SCOPE_STAGE(GetCameraView);
+
+	// 飞行记录（阶段计时始终进行；记录器未启用时 FlightRecord 为空）
+	FNamiCameraFlightRecord* FlightRecord = FlightRecorder.BeginFrame(GFrameCounter, GetCameraTimeSeconds(), DeltaTime);
+	SceneQueryBroker.BeginFrame(FNamiCameraSceneQueryBroker::ResolveBudget(SceneQueryBudget));
+
+	// 相机输入每帧只读取一次，录制的也是本帧快照
+	UpdateInputSnapshot();
+
+	if (ReplayRecorder.IsRecording())
+	{
+		ReplayRecorder.CaptureFrame(*this, DeltaTime);
+	}
 
 	// ========== 【阶段 0：预处理层】 ==========
 	FNamiCameraPipelineContext Context;
 	if (!PreProcessPipeline(DeltaTime, Context))
 	{
+		FlightRecorder.CancelFrame();
+		SceneQueryBroker.EndFrame();
 		Super::GetCameraView(DeltaTime, DesiredView);
 		return;
 	}
+	FlightRecorder.MarkStage(ENamiCameraFlightStage::PreProcess);
 
 	// ========== 【阶段 1：模式计算层】 ==========
 	FNamiCameraView BaseView;
 	if (!ProcessModeStack(DeltaTime, Context, BaseView))
 	{
+		FlightRecorder.CancelFrame();
+		SceneQueryBroker.EndFrame();
 		Super::GetCameraView(DeltaTime, DesiredView);
 		return;
 	}
+	FlightRecorder.MarkStage(ENamiCameraFlightStage::ModeStack);
 
 	// ========== 【阶段 2：效果处理层】 ==========
 	// 注意：ModeComponents 现在由各 CameraMode 内部处理
@@ -122,22 +214,252 @@ void UNamiCameraComponent::GetCameraView(float DeltaTime, FMinimalViewInfo &Desi
 
 	// ========== 【阶段 2.5：相机调整层】 ==========
 	ProcessCameraAdjusts(DeltaTime, Context, EffectView);
+	FlightRecorder.MarkStage(ENamiCameraFlightStage::CameraAdjust);
 
 	// 保存 EffectView 用于 Debug（阶段5需要）
 	Context.EffectView = EffectView;
 
 	// ========== 【阶段 3：控制器同步层】 ==========
 	ProcessControllerSync(DeltaTime, Context, EffectView);
+	FlightRecorder.MarkStage(ENamiCameraFlightStage::ControllerSync);
 
 	// ========== 【阶段 4：平滑混合层】 ==========
 	FMinimalViewInfo SmoothedPOV;
 	ProcessSmoothing(DeltaTime, EffectView, SmoothedPOV);
+	FlightRecorder.MarkStage(ENamiCameraFlightStage::Smoothing);
 
 	// ========== 【阶段 5：后处理层】 ==========
 	PostProcessPipeline(DeltaTime, Context, SmoothedPOV);
+	FlightRecorder.MarkStage(ENamiCameraFlightStage::PostProcess);
 
 	// ========== 【最终输出】 ==========
 	DesiredView = SmoothedPOV;
+
+	SceneQueryBroker.EndFrame();
+
+	if (FlightRecord)
+	{
+		FlightRecord->BaseView = BaseView;
+		FlightRecord->AdjustedView = EffectView;
+		FlightRecord->ControlLocation = CurrentControlLocation;
+		FlightRecord->ControlRotation = CurrentControlRotation;
+		FlightRecord->SmoothedLocation = SmoothedPOV.Location;
+		FlightRecord->SmoothedRotation = SmoothedPOV.Rotation;
+		FlightRecord->SmoothedFOV = SmoothedPOV.FOV;
+		FlightRecord->NumModeWeights = static_cast<uint8>(BlendingStack.GetBlendWeights(
+			MakeArrayView(FlightRecord->ModeWeights, FNamiCameraFlightRecord::MaxModeWeights)));
+	}
+
+	const float FrameMs = FlightRecorder.EndFrame();
+	if (FrameBudgetGuard.Update(FrameMs, FNamiCameraFrameBudgetGuard::ResolveBudgetMs(FrameBudgetMs), FrameBudgetRecoverFrames))
+	{
+		NAMI_LOG_COMPONENT(Log, TEXT("[UNamiCameraComponent::GetCameraView] Degrade level -> %d (frame %.3f ms, budget %.3f ms)"),
+			static_cast<int32>(FrameBudgetGuard.GetLevel()), FrameMs, FNamiCameraFrameBudgetGuard::ResolveBudgetMs(FrameBudgetMs));
+	}
+
+	if (FlightRecord && FlightRecorderBudgetMs > 0.0f && FrameMs > FlightRecorderBudgetMs)
+	{
+		const double Now = FPlatformTime::Seconds();
+		if (Now - LastFlightRecorderDumpTime >= FlightRecorderDumpCooldown)
+		{
+			LastFlightRecorderDumpTime = Now;
+			NAMI_LOG_WARNING(TEXT("[UNamiCameraComponent::GetCameraView] Camera frame took %.3f ms (budget %.3f ms), dumping flight recorder"),
+				FrameMs, FlightRecorderBudgetMs);
+			DumpFlightRecorder(TEXT("Hitch"));
+		}
+	}
+}
+
+void UNamiCameraComponent::DumpFlightRecorder(const FString& Reason)
+{
+	if (!FlightRecorder.IsEnabled() || FlightRecorder.Num() == 0)
+	{
+		NAMI_LOG_WARNING(TEXT("[UNamiCameraComponent::DumpFlightRecorder] Flight recorder is disabled or empty for %s"), *GetNameSafe(GetOwner()));
+		return;
+	}
+
+	const FString FileName = FString::Printf(TEXT("%s_%s_%s.ncfr"),
+		*GetNameSafe(GetOwner()), *Reason, *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S_%s")));
+	FlightRecorder.DumpToFile(FPaths::ProjectSavedDir() / TEXT("NamiCamera") / TEXT("FlightRecorder") / FileName);
+}
+
+void UNamiCameraComponent::StartReplayRecording()
+{
+	ReplayRecorder.Start(*this);
+}
+
+bool UNamiCameraComponent::StopReplayRecording(const FString& FilePath)
+{
+	if (!ReplayRecorder.IsRecording())
+	{
+		NAMI_LOG_WARNING(TEXT("[UNamiCameraComponent::StopReplayRecording] %s is not recording"), *GetNameSafe(GetOwner()));
+		return false;
+	}
+
+	FString OutPath = FilePath;
+	if (OutPath.IsEmpty())
+	{
+		OutPath = FPaths::ProjectSavedDir() / TEXT("NamiCamera") / TEXT("Replay") / FString::Printf(TEXT("%s_%s.ncrp"),
+			*GetNameSafe(GetOwner()), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
+	}
+	return ReplayRecorder.Stop(OutPath);
+}
+
+double UNamiCameraComponent::GetCameraTimeSeconds() const
+{
+	if (TimeSecondsOverride.IsSet())
+	{
+		return TimeSecondsOverride.GetValue();
+	}
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0.0;
+}
+
+void UNamiCameraComponent::GetInputMouseDelta(float& OutTurn, float& OutLook) const
+{
+	OutTurn = InputSnapshot.MouseDelta.X;
+	OutLook = InputSnapshot.MouseDelta.Y;
+}
+
+void UNamiCameraComponent::UpdateInputSnapshot()
+{
+	const APlayerController* PC = GetOwnerPlayerController();
+
+	FVector2D MouseDelta = FVector2D::ZeroVector;
+	if (InputMouseDeltaOverride.IsSet())
+	{
+		MouseDelta = InputMouseDeltaOverride.GetValue();
+	}
+	else if (PC)
+	{
+		float TurnInput = 0.0f;
+		float LookUpInput = 0.0f;
+		PC->GetInputMouseDelta(TurnInput, LookUpInput);
+		MouseDelta = FVector2D(TurnInput, LookUpInput);
+	}
+
+	FVector2D LookInput = MouseDelta;
+	if (LookInputOverride.IsSet())
+	{
+		// 回放：录制值已是合并后的视角输入
+		LookInput = LookInputOverride.GetValue();
+	}
+	else
+	{
+		// 摇杆输入换算为鼠标增量单位，与鼠标取较大者
+		const FVector2D StickInput = FNamiCameraInputSnapshot::ApplyRadialDeadZone(ReadStickLookInput(PC), LookInputDeadZone) * StickLookInputScale;
+		if (StickInput.SizeSquared() > LookInput.SizeSquared())
+		{
+			LookInput = StickInput;
+		}
+	}
+
+	InputSnapshot.MouseDelta = MouseDelta;
+	InputSnapshot.LookInput = LookInput;
+	InputSnapshot.LookSpeed = LookInput.Size();
+
+	if (const APawn* Pawn = GetOwnerPawn())
+	{
+		InputSnapshot.OwnerRotation = Pawn->GetActorRotation();
+
+		const ACharacter* Character = Cast<ACharacter>(Pawn);
+		const UCharacterMovementComponent* MovementComp = Character ? Character->GetCharacterMovement() : nullptr;
+		InputSnapshot.MoveSpeed = MovementComp ? MovementComp->Velocity.Size() : Pawn->GetVelocity().Size();
+	}
+	else
+	{
+		InputSnapshot.OwnerRotation = FRotator::ZeroRotator;
+		InputSnapshot.MoveSpeed = 0.0f;
+	}
+
+	// 注册输入源：名称只在注册/注销时变化，值每帧采样一次
+	InputSnapshot.SourceValues.SetNumUninitialized(InputSources.Num());
+	for (int32 Index = 0; Index < InputSources.Num(); ++Index)
+	{
+		const FNamiCameraInputSourceRegistration& Source = InputSources[Index];
+		InputSnapshot.SourceValues[Index] = Source.Sampler ? Source.Sampler() : Source.ChannelValue;
+	}
+}
+
+void UNamiCameraComponent::RegisterInputSource(FName Name, TFunction<float()> Sampler)
+{
+	if (Name.IsNone())
+	{
+		NAMI_LOG_COMPONENT(Warning, TEXT("[UNamiCameraComponent::RegisterInputSource] Input source name is None"));
+		return;
+	}
+
+	FindOrAddInputSource(Name).Sampler = MoveTemp(Sampler);
+}
+
+void UNamiCameraComponent::UnregisterInputSource(FName Name)
+{
+	const int32 Index = InputSources.IndexOfByPredicate([Name](const FNamiCameraInputSourceRegistration& Source)
+	{
+		return Source.Name == Name;
+	});
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	// 绑定缓存的索引在名称不匹配时自动重新查找
+	InputSources.RemoveAt(Index);
+	InputSnapshot.SourceNames.RemoveAt(Index);
+	InputSnapshot.SourceValues.RemoveAt(Index);
+}
+
+void UNamiCameraComponent::SetInputChannelValue(FName Name, float Value)
+{
+	if (Name.IsNone())
+	{
+		return;
+	}
+
+	// 新值在下一次采样快照时生效，保证同一帧内所有调整器读到相同的值
+	FindOrAddInputSource(Name).ChannelValue = Value;
+}
+
+FNamiCameraInputSourceRegistration& UNamiCameraComponent::FindOrAddInputSource(FName Name)
+{
+	if (FNamiCameraInputSourceRegistration* Existing = InputSources.FindByPredicate([Name](const FNamiCameraInputSourceRegistration& Source)
+	{
+		return Source.Name == Name;
+	}))
+	{
+		return *Existing;
+	}
+
+	InputSnapshot.SourceNames.Add(Name);
+	InputSnapshot.SourceValues.Add(0.0f);
+
+	FNamiCameraInputSourceRegistration& Source = InputSources.AddDefaulted_GetRef();
+	Source.Name = Name;
+	return Source;
+}
+
+FVector2D UNamiCameraComponent::ReadStickLookInput(const APlayerController* PC) const
+{
+	const APawn* Pawn = GetOwnerPawn();
+	if (Pawn && Pawn->Implements<UNamiCameraInputProvider>())
+	{
+		return INamiCameraInputProvider::Execute_GetCameraInputVector(Pawn);
+	}
+
+	if (PC && PC->Implements<UNamiCameraInputProvider>())
+	{
+		return INamiCameraInputProvider::Execute_GetCameraInputVector(PC);
+	}
+
+	if (LookInputAction && PC)
+	{
+		if (const UEnhancedPlayerInput* PlayerInput = Cast<UEnhancedPlayerInput>(PC->PlayerInput))
+		{
+			return PlayerInput->GetActionValue(LookInputAction).Get<FVector2D>();
+		}
+	}
+
+	return FVector2D::ZeroVector;
 }
 
 APawn *UNamiCameraComponent::GetOwnerPawn() const
@@ -210,29 +532,24 @@ FNamiCameraModeHandle UNamiCameraComponent::PushCameraModeUsingInstance(UNamiCam
 				*Adjust->GetClass()->GetName());
 		}
 	}
+	for (FNamiCameraAdjustLayer& Layer : AdjustLayers)
+	{
+		if (!Layer.IsBlendingOut() && !Layer.IsFullyInactive())
+		{
+			Layer.RequestDeactivate(false);
+		}
+	}
 
-	// 准备ModeHandle
+	// 按优先级插入，并准备ModeHandle
 	FNamiCameraModeHandle ModeHandle;
 	ModeHandle.Owner = this;
-	ModeHandle.HandleId = CameraModeHandle_Impl::GetNextQueuedHandleIdForUse();
+	ModeHandle.HandleId = CameraModePriorityStack.Push(CameraModeInstance, Priority, ModeHandle.SlotIndex);
 
-	// 检查优先级，插入到合适的位置
-	int32 StackIndex = 0;
-	for (; StackIndex < CameraModePriorityStack.Num(); ++StackIndex)
+	if (ReplayRecorder.IsRecording())
 	{
-		if (CameraModePriorityStack[StackIndex].Priority > Priority)
-		{
-			break;
-		}
+		ReplayRecorder.RecordEvent(ENamiCameraReplayEventType::PushMode, CameraModeInstance, Priority);
 	}
 
-	// 插入到合适的位置
-	FNamiCameraModeStackEntry CameraModeEntry;
-	CameraModeEntry.HandleId = ModeHandle.HandleId;
-	CameraModeEntry.Priority = Priority;
-	CameraModeEntry.CameraMode = CameraModeInstance;
-	CameraModePriorityStack.Insert(CameraModeEntry, StackIndex);
-
 	// 更新混合栈
 	UpdateBlendingStack();
 
@@ -242,15 +559,10 @@ FNamiCameraModeHandle UNamiCameraComponent::PushCameraModeUsingInstance(UNamiCam
 bool UNamiCameraComponent::PopCameraMode(FNamiCameraModeHandle &ModeHandle)
 {
 	bool bResult = false;
-	if (ModeHandle.IsValid() && ModeHandle.Owner == this)
+	if (ModeHandle.Owner == this)
 	{
-		// 找到Index
-		const int32 HandleId = ModeHandle.HandleId;
-		const int32 FoundIndex = CameraModePriorityStack.IndexOfByPredicate(
-			[HandleId](const FNamiCameraModeStackEntry &CameraModeEntry)
-			{
-				return (CameraModeEntry.HandleId == HandleId);
-			});
+		// 通过槽位找到Index（句柄过期时为 INDEX_NONE，句柄同样被重置）
+		const int32 FoundIndex = CameraModePriorityStack.IndexOfHandle(ModeHandle.SlotIndex, ModeHandle.HandleId);
 
 		// 通过Index移除
 		bResult = PullCameraModeAtIndex(FoundIndex);
@@ -259,6 +571,11 @@ bool UNamiCameraComponent::PopCameraMode(FNamiCameraModeHandle &ModeHandle)
 	return bResult;
 }
 
+bool UNamiCameraComponent::IsCameraModeHandleAlive(const FNamiCameraModeHandle& ModeHandle) const
+{
+	return ModeHandle.Owner.Get() == this && CameraModePriorityStack.IsHandleAlive(ModeHandle.SlotIndex, ModeHandle.HandleId);
+}
+
 bool UNamiCameraComponent::PopCameraModeInstance(UNamiCameraModeBase *CameraMode)
 {
 	if (!IsValid(CameraMode))
@@ -266,16 +583,7 @@ bool UNamiCameraComponent::PopCameraModeInstance(UNamiCameraModeBase *CameraMode
 		return false;
 	}
 
-	const int32 FoundIndex = CameraModePriorityStack.IndexOfByPredicate(
-		[CameraMode](const FNamiCameraModeStackEntry &CameraModeEntry)
-		{
-			if (CameraModeEntry.CameraMode.IsValid())
-			{
-				return (CameraModeEntry.CameraMode.Get() == CameraMode);
-			}
-			return false;
-		});
-	return PullCameraModeAtIndex(FoundIndex);
+	return PullCameraModeAtIndex(CameraModePriorityStack.IndexOfMode(CameraMode));
 }
 
 UNamiCameraModeBase *UNamiCameraComponent::GetActiveCameraMode() const
@@ -402,20 +710,31 @@ UNamiCameraModeBase *UNamiCameraComponent::FindOrAddCameraModeInstanceInPool(TSu
 		return nullptr;
 	}
 
-	// O(1) 查找：使用 TMap 查找已存在的实例
-	if (TObjectPtr<UNamiCameraModeBase>* FoundMode = CameraModeInstancePool.Find(CameraModeClass))
+	if (UNamiCameraModeBase* FoundMode = FindCameraModeInstanceInPool(CameraModeClass))
 	{
-		if (IsValid(*FoundMode))
-		{
-			return *FoundMode;
-		}
+		++CameraModePoolStats.Hits;
+		return FoundMode;
 	}
 
-	// 如果不存在，创建一个新的 CameraMode 实例
+	// 如果不存在，当帧创建一个新的 CameraMode 实例（可通过 PreloadCameraModes 预热避免）
+	++CameraModePoolStats.Misses;
+	NAMI_LOG_COMPONENT(Log, TEXT("[UNamiCameraComponent::FindOrAddCameraModeInstanceInPool] Pool miss: %s"), *GetNameSafe(CameraModeClass));
+	return CreateCameraModeInstanceInPool(CameraModeClass);
+}
+
+UNamiCameraModeBase *UNamiCameraComponent::FindCameraModeInstanceInPool(TSubclassOf<UNamiCameraModeBase> CameraModeClass) const
+{
+	// O(1) 查找：使用 TMap 查找已存在的实例
+	const TObjectPtr<UNamiCameraModeBase>* FoundMode = CameraModeInstancePool.Find(CameraModeClass);
+	return FoundMode && IsValid(*FoundMode) ? FoundMode->Get() : nullptr;
+}
+
+UNamiCameraModeBase *UNamiCameraComponent::CreateCameraModeInstanceInPool(TSubclassOf<UNamiCameraModeBase> CameraModeClass)
+{
 	UNamiCameraModeBase *NewCameraMode = NewObject<UNamiCameraModeBase>(this, CameraModeClass, NAME_None, RF_NoFlags);
 	if (!IsValid(NewCameraMode))
 	{
-		NAMI_LOG_COMPONENT(Error, TEXT("[UNamiCameraComponent::FindOrAddCameraModeInstanceInPool] Failed to create CameraMode instance"));
+		NAMI_LOG_COMPONENT(Error, TEXT("[UNamiCameraComponent::CreateCameraModeInstanceInPool] Failed to create CameraMode instance"));
 		return nullptr;
 	}
 
@@ -425,10 +744,115 @@ UNamiCameraModeBase *UNamiCameraComponent::FindOrAddCameraModeInstanceInPool(TSu
 	return NewCameraMode;
 }
 
+void UNamiCameraComponent::PreloadCameraModeClasses(const TArray<TSoftClassPtr<UNamiCameraModeBase>>& CameraModeClasses)
+{
+	TArray<TSoftClassPtr<UNamiCameraModeBase>> PendingClasses;
+	TArray<FSoftObjectPath> PendingPaths;
+	for (const TSoftClassPtr<UNamiCameraModeBase>& ModeClass : CameraModeClasses)
+	{
+		if (ModeClass.IsNull())
+		{
+			continue;
+		}
+
+		// 已加载的类直接预热
+		if (UClass* LoadedClass = ModeClass.Get())
+		{
+			WarmUpCameraMode(LoadedClass);
+			continue;
+		}
+
+		PendingClasses.Add(ModeClass);
+		PendingPaths.Add(ModeClass.ToSoftObjectPath());
+	}
+
+	if (PendingPaths.Num() == 0)
+	{
+		return;
+	}
+
+	// 类及其直接引用的资源（BlendConfig.BlendCurve 等）一并异步加载
+	CameraModePoolStats.PendingLoads += PendingClasses.Num();
+	TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		PendingPaths,
+		FStreamableDelegate::CreateUObject(this, &ThisClass::OnCameraModePreloadCompleted, PendingClasses),
+		FStreamableManager::AsyncLoadHighPriority);
+	if (Handle.IsValid())
+	{
+		CameraModePreloadHandles.Add(Handle);
+	}
+	else
+	{
+		CameraModePoolStats.PendingLoads -= PendingClasses.Num();
+	}
+}
+
+void UNamiCameraComponent::OnCameraModePreloadCompleted(TArray<TSoftClassPtr<UNamiCameraModeBase>> CameraModeClasses)
+{
+	CameraModePoolStats.PendingLoads = FMath::Max(CameraModePoolStats.PendingLoads - CameraModeClasses.Num(), 0);
+	CameraModePreloadHandles.RemoveAll([](const TSharedPtr<FStreamableHandle>& Handle)
+	{
+		return !Handle.IsValid() || Handle->HasLoadCompleted() || Handle->WasCanceled();
+	});
+
+	for (const TSoftClassPtr<UNamiCameraModeBase>& ModeClass : CameraModeClasses)
+	{
+		if (UClass* LoadedClass = ModeClass.Get())
+		{
+			WarmUpCameraMode(LoadedClass);
+		}
+		else
+		{
+			NAMI_LOG_WARNING(TEXT("[UNamiCameraComponent::OnCameraModePreloadCompleted] Failed to load camera mode %s"), *ModeClass.ToString());
+		}
+	}
+}
+
+void UNamiCameraComponent::WarmUpCameraMode(TSubclassOf<UNamiCameraModeBase> CameraModeClass)
+{
+	if (!IsValid(CameraModeClass) || CameraModeClass->HasAnyClassFlags(CLASS_Abstract) || FindCameraModeInstanceInPool(CameraModeClass))
+	{
+		return;
+	}
+
+	UNamiCameraModeBase* CameraMode = CreateCameraModeInstanceInPool(CameraModeClass);
+	if (!CameraMode)
+	{
+		return;
+	}
+
+	// 只提前执行一次性构建（如运行时默认计算器）；推送时 NotifyCameraModeInitialize 仍完整初始化
+	CameraMode->Prewarm();
+	++CameraModePoolStats.Prewarmed;
+}
+
+void UNamiCameraComponent::DumpCameraModePoolStats() const
+{
+	const int32 Lookups = CameraModePoolStats.Hits + CameraModePoolStats.Misses;
+	UE_LOG(LogNamiCamera, Log, TEXT("[UNamiCameraComponent::DumpCameraModePoolStats] %s: Pooled=%d Hits=%d Misses=%d HitRate=%.1f%% Prewarmed=%d PendingLoads=%d"),
+		*GetNameSafe(GetOwner()),
+		CameraModeInstancePool.Num(),
+		CameraModePoolStats.Hits,
+		CameraModePoolStats.Misses,
+		Lookups > 0 ? 100.0f * CameraModePoolStats.Hits / Lookups : 0.0f,
+		CameraModePoolStats.Prewarmed,
+		CameraModePoolStats.PendingLoads);
+
+	for (const TPair<TSubclassOf<UNamiCameraModeBase>, TObjectPtr<UNamiCameraModeBase>>& Pair : CameraModeInstancePool)
+	{
+		UE_LOG(LogNamiCamera, Log, TEXT("    %s"), *GetNameSafe(Pair.Key));
+	}
+}
+
 bool UNamiCameraComponent::PullCameraModeAtIndex(int32 Index)
 {
 	if (CameraModePriorityStack.IsValidIndex(Index))
 	{
+		if (ReplayRecorder.IsRecording())
+		{
+			ReplayRecorder.RecordEvent(ENamiCameraReplayEventType::PopMode, nullptr, Index);
+		}
+
 		OnPopCameraMode.Broadcast();
 		CameraModePriorityStack.RemoveAt(Index);
 		UpdateBlendingStack();
@@ -517,6 +941,8 @@ void UNamiCameraComponent::DrawDebugCameraInfo(const FNamiCameraView& View) cons
 
 bool UNamiCameraComponent::PreProcessPipeline(float DeltaTime, FNamiCameraPipelineContext& OutContext)
 {
+	NAMI_CAMERA_SCOPE_STAGE(PreProcess);
+
 	// 重置上下文
 	OutContext.Reset();
 	OutContext.DeltaTime = DeltaTime;
@@ -546,16 +972,25 @@ bool UNamiCameraComponent::PreProcessPipeline(float DeltaTime, FNamiCameraPipeli
 
 bool UNamiCameraComponent::ProcessModeStack(float DeltaTime, const FNamiCameraPipelineContext& Context, FNamiCameraView& OutBaseView)
 {
+	NAMI_CAMERA_SCOPE_STAGE(ModeStack);
+
 	// 评估 BlendingStack 的堆栈权重
 	// EvaluateStack 内部会：
-	// 1. UpdateStack() - Tick 所有激活模式，更新混合权重
+	// 1. UpdateStack() - 推进所有激活模式的混合权重，Tick 有效贡献足够的模式
 	// 2. BlendStack() - 混合所有模式的视图
-	return BlendingStack.EvaluateStack(DeltaTime, OutBaseView);
+	// 有效贡献过低的模式跳过完整评估；帧预算降级到最高级时只完整评估栈顶模式
+	// 超出深度上限的最老模式合并为冻结快照
+	BlendingStack.SetMinContribution(ModeMinContribution);
+	BlendingStack.SetMaxDepth(ModeStackMaxDepth);
+	return BlendingStack.EvaluateStack(DeltaTime, OutBaseView,
+		FrameBudgetGuard.IsDegraded(ENamiCameraDegradeLevel::TopModeOnly));
 }
 
 
 void UNamiCameraComponent::ProcessControllerSync(float DeltaTime, const FNamiCameraPipelineContext& Context, const FNamiCameraView& InView)
 {
+	NAMI_CAMERA_SCOPE_STAGE(ControllerSync);
+
 	APlayerController* PC = Context.OwnerPC;
 	if (!PC)
 	{
@@ -612,6 +1047,8 @@ void UNamiCameraComponent::ProcessControllerSync(float DeltaTime, const FNamiCam
 
 void UNamiCameraComponent::ProcessSmoothing(float DeltaTime, const FNamiCameraView& InView, FMinimalViewInfo& OutPOV)
 {
+	NAMI_CAMERA_SCOPE_STAGE(Smoothing);
+
 	// 构建目标 POV（Mode 层计算的结果）
 	FMinimalViewInfo TargetPOV;
 	TargetPOV.Location = InView.CameraLocation;
@@ -697,6 +1134,8 @@ void UNamiCameraComponent::ProcessSmoothing(float DeltaTime, const FNamiCameraVi
 
 void UNamiCameraComponent::PostProcessPipeline(float DeltaTime, const FNamiCameraPipelineContext& Context, FMinimalViewInfo& InOutPOV)
 {
+	NAMI_CAMERA_SCOPE_STAGE(PostProcess);
+
 	// 5.1 Debug 绘制（使用阶段2的 EffectView）
 #if WITH_EDITOR
 	DrawDebugCameraInfo(Context.EffectView);
@@ -762,7 +1201,7 @@ UNamiCameraAdjust* UNamiCameraComponent::PushAdjust(TSubclassOf<UNamiCameraAdjus
 		}
 	}
 
-	// 创建实例
+	// 返回值会交给调用方长期持有，不从池中取出：否则实例混出后被他人复用，调用方随后的 PopAdjust 会弹出别人的调整器
 	UNamiCameraAdjust* AdjustInstance = NewObject<UNamiCameraAdjust>(this, AdjustClass);
 	if (!IsValid(AdjustInstance))
 	{
@@ -789,12 +1228,18 @@ bool UNamiCameraComponent::PushAdjustInstance(UNamiCameraAdjust* AdjustInstance,
 	}
 
 	// 检查同一实例是否已存在
-	if (CameraAdjustStack.Contains(AdjustInstance))
+	if (IsAdjustInStack(AdjustInstance))
 	{
 		NAMI_LOG_COMPONENT(Warning, TEXT("[UNamiCameraComponent::PushAdjustInstance] AdjustInstance already exists in stack"));
 		return false;
 	}
 
+	// 调用方重新推送已归还的实例时将其移出池，避免同时被他人取出
+	if (FNamiCameraAdjustBucket* Bucket = AdjustPool.Find(AdjustInstance->GetClass()))
+	{
+		Bucket->Instances.RemoveSingleSwap(AdjustInstance);
+	}
+
 	// 检查同类 Adjust 是否已存在
 	UClass* AdjustClass = AdjustInstance->GetClass();
 	UNamiCameraAdjust* ExistingAdjust = FindAdjustByClass(AdjustClass);
@@ -831,17 +1276,31 @@ bool UNamiCameraComponent::PushAdjustInstance(UNamiCameraAdjust* AdjustInstance,
 	// 初始化
 	AdjustInstance->Initialize(this);
 
-	// 按优先级插入到正确的位置（优先级低的在前面，优先级高的在后面）
-	int32 InsertIndex = 0;
-	for (; InsertIndex < CameraAdjustStack.Num(); ++InsertIndex)
+	// 按优先级插入到正确的位置（优先级低的在前面，优先级高的在后面；同优先级时后推送的在后）
+	// 排序键在推送时固定，之后修改 Priority 不会破坏堆栈的有序性
+	FNamiCameraAdjustStackKey StackKey;
+	StackKey.Priority = AdjustInstance->Priority;
+	StackKey.Sequence = NextAdjustPushSequence++;
+	AdjustInstance->SetStackKey(StackKey);
+	const int32 InsertIndex = Algo::UpperBound(CameraAdjustStackKeys, StackKey);
+
+	CameraAdjustStack.Insert(AdjustInstance, InsertIndex);
+	CameraAdjustStackKeys.Insert(StackKey, InsertIndex);
+
+	// 类索引同样按堆栈顺序存放，按类查找时返回的实例与遍历堆栈一致（同类实例很少，从尾部线性定位）
+	TArray<TObjectPtr<UNamiCameraAdjust>>& ClassInstances = AdjustClassIndex.FindOrAdd(AdjustClass).Instances;
+	int32 ClassInsertIndex = ClassInstances.Num();
+	while (ClassInsertIndex > 0 && ClassInstances[ClassInsertIndex - 1] && StackKey < ClassInstances[ClassInsertIndex - 1]->GetStackKey())
 	{
-		if (CameraAdjustStack[InsertIndex]->Priority > AdjustInstance->Priority)
-		{
-			break;
-		}
+		--ClassInsertIndex;
 	}
+	ClassInstances.Insert(AdjustInstance, ClassInsertIndex);
 
-	CameraAdjustStack.Insert(AdjustInstance, InsertIndex);
+	if (ReplayRecorder.IsRecording())
+	{
+		ReplayRecorder.RecordEvent(ENamiCameraReplayEventType::PushAdjust, AdjustInstance, 0, false,
+			FNamiCameraReplay::ExportAdjustConfig(*AdjustInstance));
+	}
 
 	NAMI_LOG_COMPONENT(Log, TEXT("[UNamiCameraComponent::PushAdjustInstance] Pushed %s (Priority: %d) at index %d"),
 		*AdjustClass->GetName(), AdjustInstance->Priority, InsertIndex);
@@ -851,24 +1310,25 @@ bool UNamiCameraComponent::PushAdjustInstance(UNamiCameraAdjust* AdjustInstance,
 
 bool UNamiCameraComponent::PopAdjust(UNamiCameraAdjust* AdjustInstance, bool bForceImmediate)
 {
-	if (!IsValid(AdjustInstance))
+	if (!IsValid(AdjustInstance) || !IsAdjustInStack(AdjustInstance))
 	{
 		return false;
 	}
 
-	int32 Index = CameraAdjustStack.Find(AdjustInstance);
-	if (Index == INDEX_NONE)
+	// 只有需要堆栈位置时才定位
+	if (ReplayRecorder.IsRecording())
 	{
-		return false;
+		ReplayRecorder.RecordEvent(ENamiCameraReplayEventType::PopAdjust, nullptr, FindAdjustStackIndex(AdjustInstance), bForceImmediate);
 	}
 
 	// 请求停用
 	AdjustInstance->RequestDeactivate(bForceImmediate);
 
-	// 如果是立即停用，直接从堆栈中移除
+	// 如果是立即停用，直接从堆栈中移除并归还到池中
 	if (bForceImmediate)
 	{
-		CameraAdjustStack.RemoveAt(Index);
+		RemoveAdjustAt(FindAdjustStackIndex(AdjustInstance));
+		ReleaseAdjust(AdjustInstance);
 	}
 
 	// 否则会在 CleanupInactiveCameraAdjusts 中移除
@@ -882,23 +1342,28 @@ bool UNamiCameraComponent::PopAdjustByClass(TSubclassOf<UNamiCameraAdjust> Adjus
 		return false;
 	}
 
-	// 找到所有匹配的实例
-	TArray<UNamiCameraAdjust*> ToRemove;
-	for (UNamiCameraAdjust* Adjust : CameraAdjustStack)
+	const FNamiCameraAdjustBucket* Bucket = AdjustClassIndex.Find(AdjustClass.Get());
+	if (!Bucket || Bucket->Instances.Num() == 0)
+	{
+		return false;
+	}
+
+	// 立即弹出会修改索引，先复制匹配的实例（按堆栈顺序）
+	TArray<UNamiCameraAdjust*, TInlineAllocator<8>> ToRemove;
+	for (UNamiCameraAdjust* Adjust : Bucket->Instances)
 	{
-		if (IsValid(Adjust) && Adjust->GetClass() == AdjustClass)
+		if (IsValid(Adjust))
 		{
 			ToRemove.Add(Adjust);
 		}
 	}
 
-	bool bResult = ToRemove.Num() > 0;
 	for (UNamiCameraAdjust* Adjust : ToRemove)
 	{
 		PopAdjust(Adjust, bForceImmediate);
 	}
 
-	return bResult;
+	return ToRemove.Num() > 0;
 }
 
 UNamiCameraAdjust* UNamiCameraComponent::FindAdjustByClass(TSubclassOf<UNamiCameraAdjust> AdjustClass) const
@@ -908,30 +1373,103 @@ UNamiCameraAdjust* UNamiCameraComponent::FindAdjustByClass(TSubclassOf<UNamiCame
 		return nullptr;
 	}
 
-	for (UNamiCameraAdjust* Adjust : CameraAdjustStack)
+	if (const FNamiCameraAdjustBucket* Bucket = AdjustClassIndex.Find(AdjustClass.Get()))
 	{
-		if (IsValid(Adjust) && Adjust->GetClass() == AdjustClass)
+		for (UNamiCameraAdjust* Adjust : Bucket->Instances)
 		{
-			return Adjust;
+			if (IsValid(Adjust))
+			{
+				return Adjust;
+			}
 		}
 	}
 
 	return nullptr;
 }
 
-const TArray<UNamiCameraAdjust*>& UNamiCameraComponent::GetAdjusts() const
+UNamiCameraAdjust* UNamiCameraComponent::FindAdjustByBaseClass(UClass* BaseClass) const
+{
+	if (!BaseClass)
+	{
+		return nullptr;
+	}
+
+	// 各类索引内按堆栈顺序存放，取每个匹配类的第一个有效实例，再按排序键选出堆栈中最靠前的
+	UNamiCameraAdjust* Found = nullptr;
+	for (const TPair<TObjectPtr<UClass>, FNamiCameraAdjustBucket>& Pair : AdjustClassIndex)
+	{
+		if (!Pair.Key || !Pair.Key->IsChildOf(BaseClass))
+		{
+			continue;
+		}
+
+		for (UNamiCameraAdjust* Adjust : Pair.Value.Instances)
+		{
+			if (IsValid(Adjust))
+			{
+				if (!Found || Adjust->GetStackKey() < Found->GetStackKey())
+				{
+					Found = Adjust;
+				}
+				break;
+			}
+		}
+	}
+
+	return Found;
+}
+
+bool UNamiCameraComponent::IsAdjustInStack(const UNamiCameraAdjust* Adjust) const
+{
+	const FNamiCameraAdjustBucket* Bucket = Adjust ? AdjustClassIndex.Find(Adjust->GetClass()) : nullptr;
+	return Bucket && Bucket->Instances.Contains(Adjust);
+}
+
+int32 UNamiCameraComponent::FindAdjustStackIndex(const UNamiCameraAdjust* Adjust) const
+{
+	// 排序键唯一，命中即为该实例；实例不在本堆栈时退回线性查找
+	const int32 Index = Algo::LowerBound(CameraAdjustStackKeys, Adjust->GetStackKey());
+	if (CameraAdjustStack.IsValidIndex(Index) && CameraAdjustStack[Index] == Adjust)
+	{
+		return Index;
+	}
+	return CameraAdjustStack.Find(const_cast<UNamiCameraAdjust*>(Adjust));
+}
+
+void UNamiCameraComponent::RemoveAdjustAt(int32 StackIndex)
 {
-	// 将 TObjectPtr 数组转换为原始指针数组
-	static TArray<UNamiCameraAdjust*> Result;
-	Result.Reset();
-	for (const TObjectPtr<UNamiCameraAdjust>& Adjust : CameraAdjustStack)
+	UNamiCameraAdjust* Adjust = CameraAdjustStack[StackIndex];
+	CameraAdjustStack.RemoveAt(StackIndex);
+	CameraAdjustStackKeys.RemoveAt(StackIndex);
+
+	if (!Adjust)
 	{
-		if (Adjust.Get())
+		// 实例已被 GC 清空：同步清理索引中的空条目
+		for (auto It = AdjustClassIndex.CreateIterator(); It; ++It)
 		{
-			Result.Add(Adjust.Get());
+			It->Value.Instances.RemoveAll([](const TObjectPtr<UNamiCameraAdjust>& Instance) { return Instance == nullptr; });
+			if (It->Value.Instances.Num() == 0)
+			{
+				It.RemoveCurrent();
+			}
 		}
+		return;
 	}
-	return Result;
+
+	if (FNamiCameraAdjustBucket* Bucket = AdjustClassIndex.Find(Adjust->GetClass()))
+	{
+		Bucket->Instances.RemoveSingle(Adjust);
+		if (Bucket->Instances.Num() == 0)
+		{
+			AdjustClassIndex.Remove(Adjust->GetClass());
+		}
+	}
+}
+
+const TArray<UNamiCameraAdjust*>& UNamiCameraComponent::GetAdjusts() const
+{
+	// TObjectPtr 与原始指针布局一致，直接返回堆栈视图，避免每次调用重建数组（GC 清空的条目保留为 nullptr，索引与堆栈一致）
+	return ToRawPtrTArrayUnsafe(CameraAdjustStack);
 }
 
 bool UNamiCameraComponent::HasAdjust(TSubclassOf<UNamiCameraAdjust> AdjustClass) const
@@ -939,9 +1477,175 @@ bool UNamiCameraComponent::HasAdjust(TSubclassOf<UNamiCameraAdjust> AdjustClass)
 	return FindAdjustByClass(AdjustClass) != nullptr;
 }
 
+UNamiCameraAdjust* UNamiCameraComponent::AcquireAdjust(TSubclassOf<UNamiCameraAdjust> AdjustClass)
+{
+	if (!IsValid(AdjustClass))
+	{
+		NAMI_LOG_COMPONENT(Error, TEXT("[UNamiCameraComponent::AcquireAdjust] AdjustClass is null"));
+		return nullptr;
+	}
+
+	if (FNamiCameraAdjustBucket* Bucket = AdjustPool.Find(AdjustClass.Get()))
+	{
+		while (Bucket->Instances.Num() > 0)
+		{
+			UNamiCameraAdjust* Pooled = Bucket->Instances.Pop();
+			// 池中实例不会在堆栈中（推送时已移出），这里再防御一次
+			if (IsValid(Pooled) && !IsAdjustInStack(Pooled))
+			{
+				++AdjustPoolStats.Hits;
+				Pooled->ResetForReuse();
+				return Pooled;
+			}
+		}
+	}
+
+	++AdjustPoolStats.Misses;
+	UNamiCameraAdjust* AdjustInstance = NewObject<UNamiCameraAdjust>(this, AdjustClass);
+	AdjustInstance->MarkPoolManaged();
+	return AdjustInstance;
+}
+
+void UNamiCameraComponent::ReleaseAdjust(UNamiCameraAdjust* AdjustInstance)
+{
+	// 只回收 AcquireAdjust 取得的实例；PushAdjust 返回或调用方自行创建的实例可能仍被外部持有
+	if (!IsValid(AdjustInstance) || !AdjustInstance->IsPoolManaged() || AdjustInstance->GetOuter() != this || IsAdjustInStack(AdjustInstance))
+	{
+		return;
+	}
+
+	FNamiCameraAdjustBucket& Bucket = AdjustPool.FindOrAdd(AdjustInstance->GetClass());
+	if (Bucket.Instances.Contains(AdjustInstance))
+	{
+		return;
+	}
+
+	if (Bucket.Instances.Num() >= MaxPooledAdjustsPerClass)
+	{
+		++AdjustPoolStats.Discarded;
+		return;
+	}
+
+	Bucket.Instances.Add(AdjustInstance);
+	++AdjustPoolStats.Released;
+}
+
+int32 UNamiCameraComponent::PushAdjustLayer(const FNamiCameraAdjustLayer& Layer, ENamiCameraAdjustDuplicatePolicy DuplicatePolicy)
+{
+	// 所有轻量层视为同一类，重复策略与 PushAdjustInstance 一致
+	if (AdjustLayers.Num() > 0)
+	{
+		switch (DuplicatePolicy)
+		{
+		case ENamiCameraAdjustDuplicatePolicy::KeepExisting:
+			NAMI_LOG_COMPONENT(Log, TEXT("[UNamiCameraComponent::PushAdjustLayer] Layer already exists, rejecting new layer (KeepExisting policy)"));
+			return INDEX_NONE;
+
+		case ENamiCameraAdjustDuplicatePolicy::Replace:
+			for (FNamiCameraAdjustLayer& Existing : AdjustLayers)
+			{
+				Existing.RequestDeactivate(false);
+			}
+			break;
+
+		case ENamiCameraAdjustDuplicatePolicy::ForceReplace:
+			AdjustLayers.Reset();
+			break;
+
+		case ENamiCameraAdjustDuplicatePolicy::AllowDuplicate:
+			break;
+		}
+	}
+
+	// 回放时以相同的重复策略重新推送，Replace/ForceReplace 对已有层的处理随之重现
+	if (ReplayRecorder.IsRecording())
+	{
+		ReplayRecorder.RecordEvent(ENamiCameraReplayEventType::PushLayer, nullptr, static_cast<int32>(DuplicatePolicy), false,
+			FNamiCameraReplay::ExportLayer(Layer));
+	}
+
+	// 按优先级插入（与 CameraAdjustStack 相同：同优先级时后推送的在后）
+	int32 InsertIndex = 0;
+	while (InsertIndex < AdjustLayers.Num() && AdjustLayers[InsertIndex].Priority <= Layer.Priority)
+	{
+		++InsertIndex;
+	}
+
+	FNamiCameraAdjustLayer& NewLayer = AdjustLayers.Insert_GetRef(Layer, InsertIndex);
+	NewLayer.SetId(NextAdjustPushSequence++);
+
+	NAMI_LOG_COMPONENT(Log, TEXT("[UNamiCameraComponent::PushAdjustLayer] Pushed layer %d (Priority: %d) at index %d"),
+		NewLayer.GetId(), NewLayer.Priority, InsertIndex);
+	return NewLayer.GetId();
+}
+
+bool UNamiCameraComponent::PopAdjustLayer(int32 LayerId, bool bForceImmediate)
+{
+	const int32 Index = AdjustLayers.IndexOfByPredicate([LayerId](const FNamiCameraAdjustLayer& Layer)
+	{
+		return Layer.GetId() == LayerId;
+	});
+	if (Index == INDEX_NONE)
+	{
+		return false;
+	}
+
+	if (ReplayRecorder.IsRecording())
+	{
+		ReplayRecorder.RecordEvent(ENamiCameraReplayEventType::PopLayer, nullptr, Index, bForceImmediate);
+	}
+
+	AdjustLayers[Index].RequestDeactivate(bForceImmediate);
+
+	// 立即停用时直接移除，否则在 CleanupInactiveCameraAdjusts 中移除
+	if (bForceImmediate)
+	{
+		AdjustLayers.RemoveAt(Index);
+	}
+	return true;
+}
+
+bool UNamiCameraComponent::PopAdjustLayers(bool bForceImmediate)
+{
+	// 立即弹出会修改数组，先复制句柄；逐层经 PopAdjustLayer 以便回放录制
+	TArray<int32, TInlineAllocator<8>> LayerIds;
+	for (const FNamiCameraAdjustLayer& Layer : AdjustLayers)
+	{
+		LayerIds.Add(Layer.GetId());
+	}
+
+	for (const int32 LayerId : LayerIds)
+	{
+		PopAdjustLayer(LayerId, bForceImmediate);
+	}
+
+	return LayerIds.Num() > 0;
+}
+
+void UNamiCameraComponent::DumpAdjustPoolStats() const
+{
+	int32 Pooled = 0;
+	for (const TPair<TObjectPtr<UClass>, FNamiCameraAdjustBucket>& Pair : AdjustPool)
+	{
+		Pooled += Pair.Value.Instances.Num();
+	}
+
+	const int32 Lookups = AdjustPoolStats.Hits + AdjustPoolStats.Misses;
+	UE_LOG(LogNamiCamera, Log, TEXT("[UNamiCameraComponent::DumpAdjustPoolStats] %s: Pooled=%d Hits=%d Misses=%d HitRate=%.1f%% Released=%d Discarded=%d"),
+		*GetNameSafe(GetOwner()),
+		Pooled,
+		AdjustPoolStats.Hits,
+		AdjustPoolStats.Misses,
+		Lookups > 0 ? 100.0f * AdjustPoolStats.Hits / Lookups : 0.0f,
+		AdjustPoolStats.Released,
+		AdjustPoolStats.Discarded);
+}
+
 void UNamiCameraComponent::ProcessCameraAdjusts(float DeltaTime, FNamiCameraPipelineContext& Context, FNamiCameraView& InOutView)
 {
-	if (CameraAdjustStack.Num() == 0)
+	NAMI_CAMERA_SCOPE_STAGE(CameraAdjust);
+
+	if (CameraAdjustStack.Num() == 0 && AdjustLayers.Num() == 0)
 	{
 		return;
 	}
@@ -1036,310 +1740,346 @@ FNamiCameraAdjustParams UNamiCameraComponent::CalculateCombinedAdjustParams(floa
 
 	// 使用四元数累积臂旋转偏移（避免欧拉角插值问题）
 	FQuat CombinedArmRotationQuat = FQuat::Identity;
-	FQuat CurrentArmQuat = CurrentArmRotation.Quaternion();
 	bool bHasArmRotation = false;
 
-	for (UNamiCameraAdjust* Adjust : CameraAdjustStack)
+	// 调整器与轻量层共用本帧的输入快照（GetCameraView 开始时已采样）
+	const FNamiCameraInputSnapshot& Inputs = InputSnapshot;
+
+	// 调整器与轻量层都按（优先级, 推送序号）升序，归并遍历以保持与单一堆栈相同的合并顺序（同优先级时先推送的在前）
+	int32 AdjustIndex = 0;
+	int32 LayerIndex = 0;
+	while (AdjustIndex < CameraAdjustStack.Num() || LayerIndex < AdjustLayers.Num())
 	{
+		const bool bTakeLayer = LayerIndex < AdjustLayers.Num()
+			&& (AdjustIndex >= CameraAdjustStack.Num()
+				|| FNamiCameraAdjustStackKey{ AdjustLayers[LayerIndex].Priority, AdjustLayers[LayerIndex].GetId() } < CameraAdjustStackKeys[AdjustIndex]);
+
+		if (bTakeLayer)
+		{
+			// 轻量层：原生推进与求值，无 ProcessEvent/虚函数调用
+			FNamiCameraAdjustLayer& Layer = AdjustLayers[LayerIndex++];
+			Layer.Advance(DeltaTime, Inputs);
+			if (Layer.GetCurrentBlendWeight() > 0.f)
+			{
+				AccumulateAdjustParams(Layer, Layer.GetWeightedParams(Inputs), CurrentArmRotation, CurrentView,
+					CombinedParams, CombinedArmRotationQuat, bHasArmRotation);
+			}
+			continue;
+		}
+
+		UNamiCameraAdjust* Adjust = CameraAdjustStack[AdjustIndex++];
 		if (!IsValid(Adjust))
 		{
 			continue;
 		}
 
 		// 获取经过权重缩放的参数（这会触发状态更新）
-		FNamiCameraAdjustParams AdjustParams = Adjust->GetWeightedAdjustParams(DeltaTime);
+		FNamiCameraAdjustParams AdjustParams;
+		{
+			NAMI_CAMERA_SCOPE_OBJECT(Adjust);
+			AdjustParams = Adjust->GetWeightedAdjustParams(DeltaTime, Inputs);
+		}
 
 		// 跳过权重为0的调整器
-		float Weight = Adjust->GetCurrentBlendWeight();
-		if (Weight <= 0.f)
+		if (Adjust->GetCurrentBlendWeight() <= 0.f)
 		{
 			continue;
 		}
 
-		// 按每个参数的 BlendMode 分别处理
+		AccumulateAdjustParams(*Adjust, AdjustParams, CurrentArmRotation, CurrentView, CombinedParams, CombinedArmRotationQuat, bHasArmRotation);
+	}
 
-		// FOV
-		if (AdjustParams.HasFlag(ENamiCameraAdjustModifiedFlags::FOV))
-		{
-			// 目前 FOV 只支持 Additive 模式，直接累加
-			CombinedParams.FOVOffset += AdjustParams.FOVOffset;
-			CombinedParams.FOVBlendMode = AdjustParams.FOVBlendMode;
-			CombinedParams.MarkFOVModified();
-		}
+	// 将四元数转换回欧拉角偏移
+	// 归一化到 0-360° 范围，确保与系统其他部分一致，避免 ±180° 边界跳变
+	if (bHasArmRotation)
+	{
+		CombinedParams.ArmRotationOffset = FNamiCameraMath::NormalizeRotatorTo360(CombinedArmRotationQuat.Rotator());
+		CombinedParams.MarkArmRotationModified();
+	}
+
+	return CombinedParams;
+}
 
-		// ArmLength
-		if (AdjustParams.HasFlag(ENamiCameraAdjustModifiedFlags::TargetArmLength))
+template <typename AdjustType>
+void UNamiCameraComponent::AccumulateAdjustParams(AdjustType& Adjust, const FNamiCameraAdjustParams& AdjustParams, const FRotator& CurrentArmRotation,
+	const FNamiCameraView& CurrentView, FNamiCameraAdjustParams& CombinedParams, FQuat& CombinedArmRotationQuat, bool& bHasArmRotation)
+{
+	const float Weight = Adjust.GetCurrentBlendWeight();
+	const FQuat CurrentArmQuat = CurrentArmRotation.Quaternion();
+
+	// 按每个参数的 BlendMode 分别处理
+
+	// FOV
+	if (AdjustParams.HasFlag(ENamiCameraAdjustModifiedFlags::FOV))
+	{
+		// 目前 FOV 只支持 Additive 模式，直接累加
+		CombinedParams.FOVOffset += AdjustParams.FOVOffset;
+		CombinedParams.FOVBlendMode = AdjustParams.FOVBlendMode;
+		CombinedParams.MarkFOVModified();
+	}
+
+	// ArmLength
+	if (AdjustParams.HasFlag(ENamiCameraAdjustModifiedFlags::TargetArmLength))
+	{
+		CombinedParams.TargetArmLengthOffset += AdjustParams.TargetArmLengthOffset;
+		CombinedParams.ArmLengthBlendMode = AdjustParams.ArmLengthBlendMode;
+		CombinedParams.MarkTargetArmLengthModified();
+	}
+
+	// ArmRotation - 检查玩家输入控制后使用四元数进行混合计算
+	if (AdjustParams.HasFlag(ENamiCameraAdjustModifiedFlags::ArmRotation))
+	{
+		bool bSkipArmRotation = false;
+
+		// 检查是否允许玩家输入
+		if (Adjust.bAllowPlayerInput)
 		{
-			CombinedParams.TargetArmLengthOffset += AdjustParams.TargetArmLengthOffset;
-			CombinedParams.ArmLengthBlendMode = AdjustParams.ArmLengthBlendMode;
-			CombinedParams.MarkTargetArmLengthModified();
+			// 允许玩家输入，跳过 ArmRotation 混合
+			bSkipArmRotation = true;
 		}
-
-		// ArmRotation - 检查玩家输入控制后使用四元数进行混合计算
-		if (AdjustParams.HasFlag(ENamiCameraAdjustModifiedFlags::ArmRotation))
+		// 检查混出状态 - 混出期间允许玩家输入
+		else if (Adjust.IsBlendingOut())
 		{
-			bool bSkipArmRotation = false;
-
-			// 检查是否允许玩家输入
-			if (Adjust->bAllowPlayerInput)
-			{
-				// 允许玩家输入，跳过 ArmRotation 混合
-				bSkipArmRotation = true;
-			}
-			// 检查混出状态 - 混出期间允许玩家输入
-			else if (Adjust->IsBlendingOut())
+			// 混出开始的第一帧：同步 ControlRotation 到当前位置（防止瞬切）
+			if (!Adjust.IsBlendOutSynced())
 			{
-				// 混出开始的第一帧：同步 ControlRotation 到当前位置（防止瞬切）
-				if (!Adjust->IsBlendOutSynced())
+				// 计算混出前相机臂的实际位置
+				// 混出前是 Active 状态（权重=1.0），相机就在目标位置
+				FRotator AdjustedArmRotation = CurrentArmRotation;
+				if (AdjustParams.ArmRotationBlendMode == ENamiCameraAdjustBlendMode::Override)
 				{
-					// 计算混出前相机臂的实际位置
-					// 混出前是 Active 状态（权重=1.0），相机就在目标位置
-					FRotator AdjustedArmRotation = CurrentArmRotation;
-					if (AdjustParams.ArmRotationBlendMode == ENamiCameraAdjustBlendMode::Override)
-					{
-						// Override 模式：混出前相机就在缓存的目标位置
-						// 不需要 Slerp 计算，直接使用目标旋转
-						AdjustedArmRotation = Adjust->GetCachedWorldArmRotationTarget();
-					}
-					else
-					{
-						// Additive 模式：使用满权重的偏移
-						// AdjustParams 中的偏移已经被当前权重缩放过了，需要还原到满权重
-						float CurrentWeight = Adjust->GetCurrentBlendWeight();
-						FRotator FullWeightOffset = (CurrentWeight > KINDA_SMALL_NUMBER)
-							? AdjustParams.ArmRotationOffset * (1.0f / CurrentWeight)
-							: AdjustParams.ArmRotationOffset;
-						AdjustedArmRotation = CurrentArmRotation + FullWeightOffset;
-					}
-
-					// 将 ArmRotation 转换为 ControlRotation
-					// 注意：不使用 Normalize()，避免 ±180° 边界跳变
-					FRotator AdjustedControlRotation = AdjustedArmRotation;
-					AdjustedControlRotation.Yaw += 180.0f;
-					AdjustedControlRotation.Pitch = -AdjustedControlRotation.Pitch;
-
-					// 获取同步前的状态
-					APlayerController* PC = GetOwnerPlayerController();
-					FRotator OldControlRotation = PC ? PC->GetControlRotation() : FRotator::ZeroRotator;
-
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("[BlendOut] ========== 混出同步 =========="));
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("[BlendOut] 混出前 View:"));
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  CameraLocation: X=%.2f Y=%.2f Z=%.2f"),
-						CurrentView.CameraLocation.X, CurrentView.CameraLocation.Y, CurrentView.CameraLocation.Z);
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  CameraRotation: P=%.2f Y=%.2f R=%.2f"),
-						CurrentView.CameraRotation.Pitch, CurrentView.CameraRotation.Yaw, CurrentView.CameraRotation.Roll);
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  PivotLocation: X=%.2f Y=%.2f Z=%.2f"),
-						CurrentView.PivotLocation.X, CurrentView.PivotLocation.Y, CurrentView.PivotLocation.Z);
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  ControlRotation(View): P=%.2f Y=%.2f"),
-						CurrentView.ControlRotation.Pitch, CurrentView.ControlRotation.Yaw);
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  FOV: %.2f"), CurrentView.FOV);
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("[BlendOut] 相机臂信息:"));
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  CurrentArmRotation(Mode输出): P=%.2f Y=%.2f"),
-						CurrentArmRotation.Pitch, CurrentArmRotation.Yaw);
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  TargetArmRotation(缓存目标): P=%.2f Y=%.2f"),
-						Adjust->GetCachedWorldArmRotationTarget().Pitch, Adjust->GetCachedWorldArmRotationTarget().Yaw);
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  AdjustedArmRotation(同步值): P=%.2f Y=%.2f"),
-						AdjustedArmRotation.Pitch, AdjustedArmRotation.Yaw);
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  BlendWeight: %.3f"), Weight);
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("[BlendOut] ControlRotation:"));
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  PC->ControlRotation(同步前): P=%.2f Y=%.2f"),
-						OldControlRotation.Pitch, OldControlRotation.Yaw);
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  AdjustedControlRotation(同步值): P=%.2f Y=%.2f"),
-						AdjustedControlRotation.Pitch, AdjustedControlRotation.Yaw);
-
-					// 同步 ControlRotation
-					SyncArmRotationToControlRotation(AdjustedControlRotation);
-					bPendingControlRotationSync = true;
-					PendingControlRotation = AdjustedControlRotation;
-
-					// 记录同步后的状态
-					FRotator NewControlRotation = PC ? PC->GetControlRotation() : FRotator::ZeroRotator;
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("[BlendOut] 同步后:"));
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  PC->ControlRotation(同步后): P=%.2f Y=%.2f"),
-						NewControlRotation.Pitch, NewControlRotation.Yaw);
-
-					// 标记已同步
-					Adjust->MarkBlendOutSynced();
-
-					// 【关键】这一帧继续应用 CameraAdjust 偏移
-					// 因为 Mode 是用旧的 ControlRotation 计算的
-					// 下一帧 Mode 才会用新同步的 ControlRotation
+					// Override 模式：混出前相机就在缓存的目标位置
+					// 不需要 Slerp 计算，直接使用目标旋转
+					AdjustedArmRotation = Adjust.GetCachedWorldArmRotationTarget();
 				}
 				else
 				{
-					// 第二帧及以后：Mode 已经用新 ControlRotation，跳过偏移
-					bSkipArmRotation = true;
-				}
-			}
-			// 检查输入打断（仅在未被打断时检测）
-			else if (!Adjust->IsInputInterrupted())
-			{
-				bool bHasInput = DetectPlayerCameraInput(Adjust->InputInterruptThreshold);
-				// 每秒打印一次输入检测状态（避免日志刷屏）
-				static float LastLogTime = 0.f;
-				float CurrentTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.f;
-				if (CurrentTime - LastLogTime > 1.0f)
-				{
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("[InputInterrupt] 输入检测: bHasInput=%s, Threshold=%.2f"),
-						bHasInput ? TEXT("true") : TEXT("false"), Adjust->InputInterruptThreshold);
-					LastLogTime = CurrentTime;
-				}
-				if (bHasInput)
-				{
-					// 计算应用 CameraAdjust 偏移后的臂旋转
-					// 这才是相机实际所在位置对应的臂旋转
-					FRotator AdjustedArmRotation = CurrentArmRotation;
-					if (AdjustParams.ArmRotationBlendMode == ENamiCameraAdjustBlendMode::Override)
-					{
-						// Override 模式：计算 Slerp 混合后的旋转
-						FQuat TargetQuat = Adjust->GetCachedWorldArmRotationTarget().Quaternion();
-						FQuat InterpolatedQuat = FQuat::Slerp(CurrentArmQuat, TargetQuat, Weight);
-						// 归一化到 0-360° 范围，避免 ±180° 边界跳变
-						AdjustedArmRotation = FNamiCameraMath::NormalizeRotatorTo360(InterpolatedQuat.Rotator());
-					}
-					else
-					{
-						// Additive 模式：加上偏移，然后归一化
-						AdjustedArmRotation = FNamiCameraMath::NormalizeRotatorTo360(CurrentArmRotation + AdjustParams.ArmRotationOffset);
-					}
-
-					// 将 ArmRotation 转换为 ControlRotation
-					// ArmRotation 是从 Pivot 到相机的方向
-					// ControlRotation 是相机看的方向（朝向角色）= ArmRotation + 180°
-					// 注意：不使用 Normalize()，避免 ±180° 边界跳变
-					FRotator AdjustedControlRotation = AdjustedArmRotation;
-					AdjustedControlRotation.Yaw += 180.0f;
-					AdjustedControlRotation.Pitch = -AdjustedControlRotation.Pitch;
-
-					// 记录打断前的状态
-					APlayerController* PC = GetOwnerPlayerController();
-					FRotator OldControlRotation = PC ? PC->GetControlRotation() : FRotator::ZeroRotator;
-
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("[InputInterrupt] ========== 输入打断触发 =========="));
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("[InputInterrupt] 打断前 View (CameraAdjust应用前):"));
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  CameraLocation: X=%.2f Y=%.2f Z=%.2f"),
-						CurrentView.CameraLocation.X, CurrentView.CameraLocation.Y, CurrentView.CameraLocation.Z);
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  CameraRotation: P=%.2f Y=%.2f R=%.2f"),
-						CurrentView.CameraRotation.Pitch, CurrentView.CameraRotation.Yaw, CurrentView.CameraRotation.Roll);
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  PivotLocation: X=%.2f Y=%.2f Z=%.2f"),
-						CurrentView.PivotLocation.X, CurrentView.PivotLocation.Y, CurrentView.PivotLocation.Z);
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  ControlRotation(View): P=%.2f Y=%.2f R=%.2f"),
-						CurrentView.ControlRotation.Pitch, CurrentView.ControlRotation.Yaw, CurrentView.ControlRotation.Roll);
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  FOV: %.2f"), CurrentView.FOV);
-
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("[InputInterrupt] 相机臂信息:"));
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  CurrentArmRotation(Mode输出): P=%.2f Y=%.2f R=%.2f"),
-						CurrentArmRotation.Pitch, CurrentArmRotation.Yaw, CurrentArmRotation.Roll);
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  AdjustedArmRotation(Slerp后): P=%.2f Y=%.2f R=%.2f"),
-						AdjustedArmRotation.Pitch, AdjustedArmRotation.Yaw, AdjustedArmRotation.Roll);
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  AdjustedControlRotation(Arm+180): P=%.2f Y=%.2f R=%.2f"),
-						AdjustedControlRotation.Pitch, AdjustedControlRotation.Yaw, AdjustedControlRotation.Roll);
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  TargetArmRotation: P=%.2f Y=%.2f R=%.2f"),
-						Adjust->GetCachedWorldArmRotationTarget().Pitch, Adjust->GetCachedWorldArmRotationTarget().Yaw, Adjust->GetCachedWorldArmRotationTarget().Roll);
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  BlendWeight: %.3f"), Weight);
-
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("[InputInterrupt] ControlRotation:"));
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  PC->ControlRotation(打断前): P=%.2f Y=%.2f R=%.2f"),
-						OldControlRotation.Pitch, OldControlRotation.Yaw, OldControlRotation.Roll);
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  CurrentControlRotation(缓存): P=%.2f Y=%.2f R=%.2f"),
-						CurrentControlRotation.Pitch, CurrentControlRotation.Yaw, CurrentControlRotation.Roll);
-
-					// 保存打断前的视图（用于后续帧对比）
-					// 注意：这里保存的是 CameraAdjust 应用前的视图
-					// 实际相机位置需要在 ApplyAdjustParamsToView 后才知道
-					InputInterruptSavedView = CurrentView;
-					InputInterruptDebugFrameCounter = 1;
-
-					// 同步 ControlRotation（不是 ArmRotation！）
-					// ControlRotation = 相机朝向 = ArmRotation + 180°
-					// 这样下一帧 Mode 用新 ControlRotation 计算出的 ArmRotation = 当前相机臂位置
-					SyncArmRotationToControlRotation(AdjustedControlRotation);
-
-					// 设置待同步标记，让 ProcessCameraAdjusts 修改 InOutView.ControlRotation
-					// 这样 ProcessControllerSync 就会使用正确的值，而不是 Mode 的输出
-					bPendingControlRotationSync = true;
-					PendingControlRotation = AdjustedControlRotation;
-
-					// 记录打断后的状态
-					FRotator NewControlRotation = PC ? PC->GetControlRotation() : FRotator::ZeroRotator;
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("[InputInterrupt] 同步后:"));
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  PC->ControlRotation(打断后): P=%.2f Y=%.2f R=%.2f"),
-						NewControlRotation.Pitch, NewControlRotation.Yaw, NewControlRotation.Roll);
-					NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  CurrentControlRotation(缓存): P=%.2f Y=%.2f R=%.2f"),
-						CurrentControlRotation.Pitch, CurrentControlRotation.Yaw, CurrentControlRotation.Roll);
-
-					// 触发输入打断
-					Adjust->TriggerInputInterrupt();
-
-					// 【关键】这一帧继续应用 ArmRotation 偏移，不设置 bSkipArmRotation
-					// 下一帧 IsInputInterrupted() 为 true，才会跳过
+					// Additive 模式：使用满权重的偏移
+					// AdjustParams 中的偏移已经被当前权重缩放过了，需要还原到满权重
+					float CurrentWeight = Adjust.GetCurrentBlendWeight();
+					FRotator FullWeightOffset = (CurrentWeight > KINDA_SMALL_NUMBER)
+						? AdjustParams.ArmRotationOffset * (1.0f / CurrentWeight)
+						: AdjustParams.ArmRotationOffset;
+					AdjustedArmRotation = CurrentArmRotation + FullWeightOffset;
 				}
+
+				// 将 ArmRotation 转换为 ControlRotation
+				// 注意：不使用 Normalize()，避免 ±180° 边界跳变
+				FRotator AdjustedControlRotation = AdjustedArmRotation;
+				AdjustedControlRotation.Yaw += 180.0f;
+				AdjustedControlRotation.Pitch = -AdjustedControlRotation.Pitch;
+
+				// 获取同步前的状态
+				APlayerController* PC = GetOwnerPlayerController();
+				FRotator OldControlRotation = PC ? PC->GetControlRotation() : FRotator::ZeroRotator;
+
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("[BlendOut] ========== 混出同步 =========="));
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("[BlendOut] 混出前 View:"));
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  CameraLocation: X=%.2f Y=%.2f Z=%.2f"),
+					CurrentView.CameraLocation.X, CurrentView.CameraLocation.Y, CurrentView.CameraLocation.Z);
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  CameraRotation: P=%.2f Y=%.2f R=%.2f"),
+					CurrentView.CameraRotation.Pitch, CurrentView.CameraRotation.Yaw, CurrentView.CameraRotation.Roll);
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  PivotLocation: X=%.2f Y=%.2f Z=%.2f"),
+					CurrentView.PivotLocation.X, CurrentView.PivotLocation.Y, CurrentView.PivotLocation.Z);
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  ControlRotation(View): P=%.2f Y=%.2f"),
+					CurrentView.ControlRotation.Pitch, CurrentView.ControlRotation.Yaw);
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  FOV: %.2f"), CurrentView.FOV);
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("[BlendOut] 相机臂信息:"));
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  CurrentArmRotation(Mode输出): P=%.2f Y=%.2f"),
+					CurrentArmRotation.Pitch, CurrentArmRotation.Yaw);
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  TargetArmRotation(缓存目标): P=%.2f Y=%.2f"),
+					Adjust.GetCachedWorldArmRotationTarget().Pitch, Adjust.GetCachedWorldArmRotationTarget().Yaw);
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  AdjustedArmRotation(同步值): P=%.2f Y=%.2f"),
+					AdjustedArmRotation.Pitch, AdjustedArmRotation.Yaw);
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  BlendWeight: %.3f"), Weight);
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("[BlendOut] ControlRotation:"));
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  PC->ControlRotation(同步前): P=%.2f Y=%.2f"),
+					OldControlRotation.Pitch, OldControlRotation.Yaw);
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  AdjustedControlRotation(同步值): P=%.2f Y=%.2f"),
+					AdjustedControlRotation.Pitch, AdjustedControlRotation.Yaw);
+
+				// 同步 ControlRotation
+				SyncArmRotationToControlRotation(AdjustedControlRotation);
+				bPendingControlRotationSync = true;
+				PendingControlRotation = AdjustedControlRotation;
+
+				// 记录同步后的状态
+				FRotator NewControlRotation = PC ? PC->GetControlRotation() : FRotator::ZeroRotator;
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("[BlendOut] 同步后:"));
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  PC->ControlRotation(同步后): P=%.2f Y=%.2f"),
+					NewControlRotation.Pitch, NewControlRotation.Yaw);
+
+				// 标记已同步
+				Adjust.MarkBlendOutSynced();
+
+				// 【关键】这一帧继续应用 CameraAdjust 偏移
+				// 因为 Mode 是用旧的 ControlRotation 计算的
+				// 下一帧 Mode 才会用新同步的 ControlRotation
 			}
 			else
 			{
-				// 已被打断，跳过 ArmRotation
+				// 第二帧及以后：Mode 已经用新 ControlRotation，跳过偏移
 				bSkipArmRotation = true;
 			}
-
-			if (!bSkipArmRotation)
+		}
+		// 检查输入打断（仅在未被打断时检测）
+		else if (!Adjust.IsInputInterrupted())
+		{
+			bool bHasInput = DetectPlayerCameraInput(Adjust.InputInterruptThreshold);
+			// 每秒打印一次输入检测状态（避免日志刷屏）
+			static float LastLogTime = 0.f;
+			float CurrentTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.f;
+			if (CurrentTime - LastLogTime > 1.0f)
 			{
-				bHasArmRotation = true;
-
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("[InputInterrupt] 输入检测: bHasInput=%s, Threshold=%.2f"),
+					bHasInput ? TEXT("true") : TEXT("false"), Adjust.InputInterruptThreshold);
+				LastLogTime = CurrentTime;
+			}
+			if (bHasInput)
+			{
+				// 计算应用 CameraAdjust 偏移后的臂旋转
+				// 这才是相机实际所在位置对应的臂旋转
+				FRotator AdjustedArmRotation = CurrentArmRotation;
 				if (AdjustParams.ArmRotationBlendMode == ENamiCameraAdjustBlendMode::Override)
 				{
-					// Override 模式：使用四元数 Slerp 从当前位置混合到目标
-					FQuat TargetQuat = Adjust->GetCachedWorldArmRotationTarget().Quaternion();
-					// Slerp 计算从当前到目标的插值旋转
+					// Override 模式：计算 Slerp 混合后的旋转
+					FQuat TargetQuat = Adjust.GetCachedWorldArmRotationTarget().Quaternion();
 					FQuat InterpolatedQuat = FQuat::Slerp(CurrentArmQuat, TargetQuat, Weight);
-					// 计算相对于当前的偏移四元数
-					FQuat OffsetQuat = InterpolatedQuat * CurrentArmQuat.Inverse();
-					// 组合到累积的旋转四元数
-					CombinedArmRotationQuat = CombinedArmRotationQuat * OffsetQuat;
+					// 归一化到 0-360° 范围，避免 ±180° 边界跳变
+					AdjustedArmRotation = FNamiCameraMath::NormalizeRotatorTo360(InterpolatedQuat.Rotator());
 				}
 				else
 				{
-					// Additive 模式：将偏移转换为四元数后组合（偏移已被权重缩放）
-					FQuat AdditiveQuat = AdjustParams.ArmRotationOffset.Quaternion();
-					CombinedArmRotationQuat = CombinedArmRotationQuat * AdditiveQuat;
+					// Additive 模式：加上偏移，然后归一化
+					AdjustedArmRotation = FNamiCameraMath::NormalizeRotatorTo360(CurrentArmRotation + AdjustParams.ArmRotationOffset);
 				}
-				CombinedParams.ArmRotationBlendMode = AdjustParams.ArmRotationBlendMode;
+
+				// 将 ArmRotation 转换为 ControlRotation
+				// ArmRotation 是从 Pivot 到相机的方向
+				// ControlRotation 是相机看的方向（朝向角色）= ArmRotation + 180°
+				// 注意：不使用 Normalize()，避免 ±180° 边界跳变
+				FRotator AdjustedControlRotation = AdjustedArmRotation;
+				AdjustedControlRotation.Yaw += 180.0f;
+				AdjustedControlRotation.Pitch = -AdjustedControlRotation.Pitch;
+
+				// 记录打断前的状态
+				APlayerController* PC = GetOwnerPlayerController();
+				FRotator OldControlRotation = PC ? PC->GetControlRotation() : FRotator::ZeroRotator;
+
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("[InputInterrupt] ========== 输入打断触发 =========="));
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("[InputInterrupt] 打断前 View (CameraAdjust应用前):"));
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  CameraLocation: X=%.2f Y=%.2f Z=%.2f"),
+					CurrentView.CameraLocation.X, CurrentView.CameraLocation.Y, CurrentView.CameraLocation.Z);
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  CameraRotation: P=%.2f Y=%.2f R=%.2f"),
+					CurrentView.CameraRotation.Pitch, CurrentView.CameraRotation.Yaw, CurrentView.CameraRotation.Roll);
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  PivotLocation: X=%.2f Y=%.2f Z=%.2f"),
+					CurrentView.PivotLocation.X, CurrentView.PivotLocation.Y, CurrentView.PivotLocation.Z);
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  ControlRotation(View): P=%.2f Y=%.2f R=%.2f"),
+					CurrentView.ControlRotation.Pitch, CurrentView.ControlRotation.Yaw, CurrentView.ControlRotation.Roll);
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  FOV: %.2f"), CurrentView.FOV);
+
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("[InputInterrupt] 相机臂信息:"));
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  CurrentArmRotation(Mode输出): P=%.2f Y=%.2f R=%.2f"),
+					CurrentArmRotation.Pitch, CurrentArmRotation.Yaw, CurrentArmRotation.Roll);
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  AdjustedArmRotation(Slerp后): P=%.2f Y=%.2f R=%.2f"),
+					AdjustedArmRotation.Pitch, AdjustedArmRotation.Yaw, AdjustedArmRotation.Roll);
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  AdjustedControlRotation(Arm+180): P=%.2f Y=%.2f R=%.2f"),
+					AdjustedControlRotation.Pitch, AdjustedControlRotation.Yaw, AdjustedControlRotation.Roll);
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  TargetArmRotation: P=%.2f Y=%.2f R=%.2f"),
+					Adjust.GetCachedWorldArmRotationTarget().Pitch, Adjust.GetCachedWorldArmRotationTarget().Yaw, Adjust.GetCachedWorldArmRotationTarget().Roll);
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  BlendWeight: %.3f"), Weight);
+
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("[InputInterrupt] ControlRotation:"));
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  PC->ControlRotation(打断前): P=%.2f Y=%.2f R=%.2f"),
+					OldControlRotation.Pitch, OldControlRotation.Yaw, OldControlRotation.Roll);
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  CurrentControlRotation(缓存): P=%.2f Y=%.2f R=%.2f"),
+					CurrentControlRotation.Pitch, CurrentControlRotation.Yaw, CurrentControlRotation.Roll);
+
+				// 保存打断前的视图（用于后续帧对比）
+				// 注意：这里保存的是 CameraAdjust 应用前的视图
+				// 实际相机位置需要在 ApplyAdjustParamsToView 后才知道
+				InputInterruptSavedView = CurrentView;
+				InputInterruptDebugFrameCounter = 1;
+
+				// 同步 ControlRotation（不是 ArmRotation！）
+				// ControlRotation = 相机朝向 = ArmRotation + 180°
+				// 这样下一帧 Mode 用新 ControlRotation 计算出的 ArmRotation = 当前相机臂位置
+				SyncArmRotationToControlRotation(AdjustedControlRotation);
+
+				// 设置待同步标记，让 ProcessCameraAdjusts 修改 InOutView.ControlRotation
+				// 这样 ProcessControllerSync 就会使用正确的值，而不是 Mode 的输出
+				bPendingControlRotationSync = true;
+				PendingControlRotation = AdjustedControlRotation;
+
+				// 记录打断后的状态
+				FRotator NewControlRotation = PC ? PC->GetControlRotation() : FRotator::ZeroRotator;
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("[InputInterrupt] 同步后:"));
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  PC->ControlRotation(打断后): P=%.2f Y=%.2f R=%.2f"),
+					NewControlRotation.Pitch, NewControlRotation.Yaw, NewControlRotation.Roll);
+				NAMI_LOG_INPUT_INTERRUPT(Log, TEXT("  CurrentControlRotation(缓存): P=%.2f Y=%.2f R=%.2f"),
+					CurrentControlRotation.Pitch, CurrentControlRotation.Yaw, CurrentControlRotation.Roll);
+
+				// 触发输入打断
+				Adjust.TriggerInputInterrupt();
+
+				// 【关键】这一帧继续应用 ArmRotation 偏移，不设置 bSkipArmRotation
+				// 下一帧 IsInputInterrupted() 为 true，才会跳过
 			}
 		}
-
-		// CameraOffset
-		if (AdjustParams.HasFlag(ENamiCameraAdjustModifiedFlags::CameraLocationOffset))
+		else
 		{
-			CombinedParams.CameraLocationOffset += AdjustParams.CameraLocationOffset;
-			CombinedParams.CameraOffsetBlendMode = AdjustParams.CameraOffsetBlendMode;
-			CombinedParams.MarkCameraLocationOffsetModified();
+			// 已被打断，跳过 ArmRotation
+			bSkipArmRotation = true;
 		}
 
-		// CameraRotation
-		if (AdjustParams.HasFlag(ENamiCameraAdjustModifiedFlags::CameraRotationOffset))
+		if (!bSkipArmRotation)
 		{
-			CombinedParams.CameraRotationOffset += AdjustParams.CameraRotationOffset;
-			CombinedParams.CameraRotationBlendMode = AdjustParams.CameraRotationBlendMode;
-			CombinedParams.MarkCameraRotationOffsetModified();
-		}
+			bHasArmRotation = true;
 
-		// PivotOffset
-		if (AdjustParams.HasFlag(ENamiCameraAdjustModifiedFlags::PivotOffset))
-		{
-			CombinedParams.PivotOffset += AdjustParams.PivotOffset;
-			CombinedParams.PivotOffsetBlendMode = AdjustParams.PivotOffsetBlendMode;
-			CombinedParams.MarkPivotOffsetModified();
+			if (AdjustParams.ArmRotationBlendMode == ENamiCameraAdjustBlendMode::Override)
+			{
+				// Override 模式：使用四元数 Slerp 从当前位置混合到目标
+				FQuat TargetQuat = Adjust.GetCachedWorldArmRotationTarget().Quaternion();
+				// Slerp 计算从当前到目标的插值旋转
+				FQuat InterpolatedQuat = FQuat::Slerp(CurrentArmQuat, TargetQuat, Weight);
+				// 计算相对于当前的偏移四元数
+				FQuat OffsetQuat = InterpolatedQuat * CurrentArmQuat.Inverse();
+				// 组合到累积的旋转四元数
+				CombinedArmRotationQuat = CombinedArmRotationQuat * OffsetQuat;
+			}
+			else
+			{
+				// Additive 模式：将偏移转换为四元数后组合（偏移已被权重缩放）
+				FQuat AdditiveQuat = AdjustParams.ArmRotationOffset.Quaternion();
+				CombinedArmRotationQuat = CombinedArmRotationQuat * AdditiveQuat;
+			}
+			CombinedParams.ArmRotationBlendMode = AdjustParams.ArmRotationBlendMode;
 		}
 	}
 
-	// 将四元数转换回欧拉角偏移
-	// 归一化到 0-360° 范围，确保与系统其他部分一致，避免 ±180° 边界跳变
-	if (bHasArmRotation)
+	// CameraOffset
+	if (AdjustParams.HasFlag(ENamiCameraAdjustModifiedFlags::CameraLocationOffset))
 	{
-		CombinedParams.ArmRotationOffset = FNamiCameraMath::NormalizeRotatorTo360(CombinedArmRotationQuat.Rotator());
-		CombinedParams.MarkArmRotationModified();
+		CombinedParams.CameraLocationOffset += AdjustParams.CameraLocationOffset;
+		CombinedParams.CameraOffsetBlendMode = AdjustParams.CameraOffsetBlendMode;
+		CombinedParams.MarkCameraLocationOffsetModified();
 	}
 
-	return CombinedParams;
+	// CameraRotation
+	if (AdjustParams.HasFlag(ENamiCameraAdjustModifiedFlags::CameraRotationOffset))
+	{
+		CombinedParams.CameraRotationOffset += AdjustParams.CameraRotationOffset;
+		CombinedParams.CameraRotationBlendMode = AdjustParams.CameraRotationBlendMode;
+		CombinedParams.MarkCameraRotationOffsetModified();
+	}
+
+	// PivotOffset
+	if (AdjustParams.HasFlag(ENamiCameraAdjustModifiedFlags::PivotOffset))
+	{
+		CombinedParams.PivotOffset += AdjustParams.PivotOffset;
+		CombinedParams.PivotOffsetBlendMode = AdjustParams.PivotOffsetBlendMode;
+		CombinedParams.MarkPivotOffsetModified();
+	}
 }
 
 void UNamiCameraComponent::ApplyAdjustParamsToView(const FNamiCameraAdjustParams& Params, FNamiCameraView& InOutView)
@@ -1424,24 +2164,20 @@ void UNamiCameraComponent::CleanupInactiveCameraAdjusts()
 		UNamiCameraAdjust* Adjust = CameraAdjustStack[i];
 		if (!IsValid(Adjust) || Adjust->IsFullyInactive())
 		{
-			CameraAdjustStack.RemoveAt(i);
+			RemoveAdjustAt(i);
+			ReleaseAdjust(Adjust);
 		}
 	}
+
+	AdjustLayers.RemoveAll([](const FNamiCameraAdjustLayer& Layer)
+	{
+		return Layer.IsFullyInactive();
+	});
 }
 
 bool UNamiCameraComponent::DetectPlayerCameraInput(float Threshold) const
 {
-	APlayerController* PC = GetOwnerPlayerController();
-	if (!PC)
-	{
-		return false;
-	}
-
-	float TurnInput = 0.f;
-	float LookInput = 0.f;
-	PC->GetInputMouseDelta(TurnInput, LookInput);
-
-	return FMath::Abs(TurnInput) > Threshold || FMath::Abs(LookInput) > Threshold;
+	return InputSnapshot.HasLookInput(Threshold);
 }
 
 void UNamiCameraComponent::SyncArmRotationToControlRotation(const FRotator& ArmRotation)
@@ -5,6 +5,7 @@
 #include "DrawDebugHelpers.h"
 #include "WorldCollision.h"
 #include "Core/NamiCameraMath.h"
+#include "Core/NamiCameraSceneQueryBroker.h"
 #include "Engine/World.h"
 #include "PhysicsEngine/PhysicsSettings.h"
 
@@ -133,11 +134,11 @@ FVector FNamiSpringArm::PerformCollisionTrace(const UWorld *World, const FVector
 		QueryParams.AddIgnoredActors(IgnoreActors);
 	}
 
-	FHitResult Result;
-	World->SweepSingleByChannel(Result, ArmOrigin, DesiredLoc, FQuat::Identity, ProbeChannel, FCollisionShape::MakeSphere(ProbeSize), QueryParams);
+	FVector TraceHitLocation = DesiredLoc;
+	const bool bHitSomething = SweepProbe(World, ArmOrigin, DesiredLoc, QueryParams, TraceHitLocation);
 
 	UnfixedCameraPosition = DesiredLoc;
-	FVector ResultLoc = BlendLocations(DesiredLoc, Result.Location, Result.bBlockingHit);
+	FVector ResultLoc = BlendLocations(DesiredLoc, TraceHitLocation, bHitSomething);
 
 	if (ResultLoc == DesiredLoc)
 	{
@@ -157,7 +158,7 @@ FVector FNamiSpringArm::PerformCollisionTrace(const UWorld *World, const FVector
 		return DesiredLoc;
 	}
 
-	float CurrentTime = World->GetTimeSeconds();
+	const float CurrentTime = static_cast<float>(TimeSecondsOverride.Get(World->GetTimeSeconds()));
 
 	// 检查是否需要执行碰撞检测
 	bool bShouldPerformTrace = true;
@@ -180,7 +181,6 @@ FVector FNamiSpringArm::PerformCollisionTrace(const UWorld *World, const FVector
 		}
 	}
 
-	FHitResult Result;
 	bool bHitSomething = false;
 	FVector TraceHitLocation = DesiredLoc;
 
@@ -197,10 +197,7 @@ FVector FNamiSpringArm::PerformCollisionTrace(const UWorld *World, const FVector
 		// 移除碰撞过滤代码，使用默认碰撞检测行为
 
 		// 执行碰撞检测
-		World->SweepSingleByChannel(Result, ArmOrigin, DesiredLoc, FQuat::Identity, ProbeChannel, FCollisionShape::MakeSphere(ProbeSize), QueryParams);
-
-		bHitSomething = Result.bBlockingHit;
-		TraceHitLocation = Result.Location;
+		bHitSomething = SweepProbe(World, ArmOrigin, DesiredLoc, QueryParams, TraceHitLocation);
 
 		// 绘制调试信息
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
@@ -246,6 +243,56 @@ FVector FNamiSpringArm::PerformCollisionTrace(const UWorld *World, const FVector
 	return ResultLoc;
 }
 
+bool FNamiSpringArm::SweepProbe(const UWorld *World, const FVector &ArmOrigin, const FVector &DesiredLoc, const FCollisionQueryParams &QueryParams, FVector &OutHitLocation)
+{
+	// 帧预算降级：复用上一次的结果
+	if (bReuseLastProbe && bHasLastProbe)
+	{
+		return ReuseLastProbe(ArmOrigin, DesiredLoc, OutHitLocation);
+	}
+
+	FHitResult Result;
+	ENamiCameraSceneQueryResult QueryResult;
+	if (QueryBroker)
+	{
+		const ENamiCameraSceneQueryPriority Priority = bAllowDeferredCollisionTest
+			? ENamiCameraSceneQueryPriority::Deferrable
+			: ENamiCameraSceneQueryPriority::Critical;
+		QueryResult = QueryBroker->SweepSingleByChannel(World, Result, ArmOrigin, DesiredLoc, FQuat::Identity, ProbeChannel,
+			FCollisionShape::MakeSphere(ProbeSize), QueryParams, Priority);
+	}
+	else
+	{
+		QueryResult = World->SweepSingleByChannel(Result, ArmOrigin, DesiredLoc, FQuat::Identity, ProbeChannel,
+			FCollisionShape::MakeSphere(ProbeSize), QueryParams)
+			? ENamiCameraSceneQueryResult::Hit
+			: ENamiCameraSceneQueryResult::Miss;
+	}
+
+	// 被推迟：沿当前 Arm 方向复用上一次的命中距离
+	if (QueryResult == ENamiCameraSceneQueryResult::Deferred)
+	{
+		return ReuseLastProbe(ArmOrigin, DesiredLoc, OutHitLocation);
+	}
+
+	bHasLastProbe = true;
+	bLastProbeHit = Result.bBlockingHit;
+	LastProbeHitDistance = bLastProbeHit ? FVector::Dist(ArmOrigin, Result.Location) : 0.0f;
+	OutHitLocation = Result.Location;
+	return bLastProbeHit;
+}
+
+bool FNamiSpringArm::ReuseLastProbe(const FVector &ArmOrigin, const FVector &DesiredLoc, FVector &OutHitLocation) const
+{
+	if (bLastProbeHit)
+	{
+		const FVector ArmDelta = DesiredLoc - ArmOrigin;
+		const float ArmDistance = ArmDelta.Size();
+		OutHitLocation = ArmOrigin + ArmDelta.GetSafeNormal() * FMath::Min(LastProbeHitDistance, ArmDistance);
+	}
+	return bLastProbeHit;
+}
+
 void FNamiSpringArm::UpdateCameraTransform(const FVector &FinalLocation, const FRotator &FinalRotation)
 {
 	CameraTransform.SetLocation(FinalLocation);
@@ -363,16 +410,20 @@ void FNamiSpringArm::Initialize()
 	CollisionCacheExpireTime = 0.0f;
 	CollisionRecoveryVelocity = FVector::ZeroVector;
 	CurrentCollisionRecoveryLocation = FVector::ZeroVector;
+	bHasLastProbe = false;
+	bLastProbeHit = false;
+	LastProbeHitDistance = 0.0f;
 }
 
 void FNamiSpringArm::Tick(const UObject *WorldContext, float DeltaTime, const AActor *IgnoreActor, const FTransform &InitialTransform, const FVector OffsetLocation)
 {
-	TArray<AActor *> IgnoreActorArray;
+	// 复用成员缓冲，Reset 保留容量，首帧之后不再分配
+	SingleIgnoreActorBuffer.Reset();
 	if (IgnoreActor)
 	{
-		IgnoreActorArray.Add(const_cast<AActor *>(IgnoreActor));
+		SingleIgnoreActorBuffer.Add(const_cast<AActor *>(IgnoreActor));
 	}
-	Tick(WorldContext, DeltaTime, IgnoreActorArray, InitialTransform, OffsetLocation);
+	Tick(WorldContext, DeltaTime, SingleIgnoreActorBuffer, InitialTransform, OffsetLocation);
 }
 
 void FNamiSpringArm::Tick(const UObject *WorldContext, float DeltaTime, const TArray<AActor *> &IgnoreActors, const FTransform &InitialTransform, const FVector OffsetLocation)
@@ -0,0 +1,331 @@
+// Copyright Qiu, Inc. All Rights Reserved.
+
+#include "Core/NamiCameraBenchmark.h"
+
+#include "Adjustments/NamiCameraAdjust.h"
+#include "CameraModes/NamiDualFocusCameraMode.h"
+#include "CameraModes/NamiThirdPersonCameraMode.h"
+#include "CameraModes/NamiTopDownCameraMode.h"
+#include "Components/NamiCameraComponent.h"
+#include "Components/NamiPlayerCameraManager.h"
+#include "Core/LogNamiCamera.h"
+#include "Core/NamiCameraStats.h"
+#include "Engine/World.h"
+#include "GameFramework/DefaultPawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "ModeComponents/NamiCameraDynamicFOVComponent.h"
+#include "ModeComponents/NamiCameraSpringArmComponent.h"
+
+namespace NamiCameraBenchmark_Impl
+{
+	/** 取排序后样本的百分位 */
+	static double Percentile(const TArray<double>& SortedSamples, double Percent)
+	{
+		if (SortedSamples.Num() == 0)
+		{
+			return 0.0;
+		}
+		const int32 Index = FMath::Clamp(FMath::CeilToInt(Percent * SortedSamples.Num()) - 1, 0, SortedSamples.Num() - 1);
+		return SortedSamples[Index];
+	}
+
+	static void ConfigureMode(UNamiCameraModeBase* Mode, const FNamiCameraBenchmarkConfig& Config)
+	{
+		UNamiCameraSpringArmComponent* SpringArmComp = Mode->GetComponent<UNamiCameraSpringArmComponent>();
+		if (!SpringArmComp && Config.bCollision)
+		{
+			SpringArmComp = Mode->CreateAndAddComponent<UNamiCameraSpringArmComponent>();
+		}
+		if (SpringArmComp)
+		{
+			SpringArmComp->SpringArm.bDoCollisionTest = Config.bCollision;
+		}
+
+		for (int32 Index = 0; Index < Config.ExtraComponentCount; ++Index)
+		{
+			Mode->CreateAndAddComponent<UNamiCameraDynamicFOVComponent>();
+		}
+	}
+
+	static void PushAdjusts(UNamiCameraComponent* CameraComp, int32 Count)
+	{
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			UNamiCameraAdjust* Adjust = CameraComp->AcquireAdjust(UNamiCameraAdjust::StaticClass());
+			Adjust->BlendInTime = 0.0f;
+			Adjust->Priority = Index;
+
+			FNamiCameraAdjustParams Params;
+			Params.FOVOffset = 1.0f;
+			Params.MarkFOVModified();
+			Params.CameraLocationOffset = FVector(0.0f, 5.0f, 0.0f);
+			Params.MarkCameraLocationOffsetModified();
+			Adjust->SetStaticParams(Params);
+
+			CameraComp->PushAdjustInstance(Adjust, ENamiCameraAdjustDuplicatePolicy::AllowDuplicate);
+		}
+	}
+
+	static TSubclassOf<UNamiCameraModeBase> ParseModeClass(const FString& ModeName)
+	{
+		if (ModeName.Equals(TEXT("ThirdPerson"), ESearchCase::IgnoreCase))
+		{
+			return UNamiThirdPersonCameraMode::StaticClass();
+		}
+		if (ModeName.Equals(TEXT("DualFocus"), ESearchCase::IgnoreCase))
+		{
+			return UNamiDualFocusCameraMode::StaticClass();
+		}
+		if (ModeName.Equals(TEXT("TopDown"), ESearchCase::IgnoreCase))
+		{
+			return UNamiTopDownCameraMode::StaticClass();
+		}
+		return nullptr;
+	}
+}
+
+bool FNamiCameraScenarioActors::Spawn(UWorld* World)
+{
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	SpawnParams.ObjectFlags |= RF_Transient;
+
+	PC = World->SpawnActor<APlayerController>(SpawnParams);
+	if (!PC)
+	{
+		return false;
+	}
+
+	// 替换默认的 PlayerCameraManager，NamiCameraComponent 要求 ANamiPlayerCameraManager
+	SpawnParams.Owner = PC;
+	CameraManager = World->SpawnActor<ANamiPlayerCameraManager>(SpawnParams);
+	if (!CameraManager)
+	{
+		return false;
+	}
+	if (PC->PlayerCameraManager)
+	{
+		PC->PlayerCameraManager->Destroy();
+	}
+	PC->PlayerCameraManager = CameraManager;
+	CameraManager->InitializeFor(PC);
+
+	SpawnParams.Owner = nullptr;
+	Pawn = World->SpawnActor<ADefaultPawn>(FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams);
+	if (!Pawn)
+	{
+		return false;
+	}
+	PC->Possess(Pawn);
+	return true;
+}
+
+void FNamiCameraScenarioActors::Destroy()
+{
+	if (PC)
+	{
+		PC->UnPossess();
+		PC->PlayerCameraManager = nullptr;
+	}
+	if (Pawn)
+	{
+		Pawn->Destroy();
+	}
+	if (CameraManager)
+	{
+		CameraManager->Destroy();
+	}
+	if (PC)
+	{
+		PC->Destroy();
+	}
+}
+
+FString FNamiCameraBenchmarkResult::ToJson() const
+{
+	return FString::Printf(
+		TEXT("{\"name\":\"%s\",\"frames\":%d,\"mean_ns\":%.1f,\"p50_ns\":%.1f,\"p99_ns\":%.1f,\"max_ns\":%.1f,\"allocs_per_frame\":%.3f}"),
+		*Name, Frames, MeanNs, P50Ns, P99Ns, MaxNs, AllocsPerFrame);
+}
+
+bool FNamiCameraBenchmark::RunScenario(UWorld* World, const FNamiCameraBenchmarkConfig& Config, FNamiCameraBenchmarkResult& OutResult)
+{
+	using namespace NamiCameraBenchmark_Impl;
+
+	if (!World || !Config.ModeClass || Config.Frames <= 0)
+	{
+		UE_LOG(LogNamiCamera, Error, TEXT("[FNamiCameraBenchmark::RunScenario] Invalid world or config for %s"), *Config.Name);
+		return false;
+	}
+
+	FNamiCameraScenarioActors Actors;
+	if (!Actors.Spawn(World))
+	{
+		UE_LOG(LogNamiCamera, Error, TEXT("[FNamiCameraBenchmark::RunScenario] Failed to spawn scenario actors for %s"), *Config.Name);
+		Actors.Destroy();
+		return false;
+	}
+
+	// 控制器已持有 Pawn，注册组件时 BeginPlay 才能缓存 PC / CameraManager
+	UNamiCameraComponent* CameraComp = NewObject<UNamiCameraComponent>(Actors.Pawn, NAME_None, RF_Transient);
+	CameraComp->SetupAttachment(Actors.Pawn->GetRootComponent());
+	CameraComp->RegisterComponent();
+
+	for (int32 Depth = 0; Depth < FMath::Max(Config.StackDepth, 1); ++Depth)
+	{
+		UNamiCameraModeBase* Mode = NewObject<UNamiCameraModeBase>(CameraComp, Config.ModeClass);
+		CameraComp->PushCameraModeUsingInstance(Mode);
+		ConfigureMode(Mode, Config);
+	}
+	PushAdjusts(CameraComp, Config.AdjustCount);
+
+	TArray<double> Samples;
+	Samples.Reserve(Config.Frames);
+
+	const double NsPerCycle = FPlatformTime::GetSecondsPerCycle64() * 1.0e9;
+	const int32 TotalFrames = Config.WarmupFrames + Config.Frames;
+	uint64 AllocCalls = 0;
+	FMinimalViewInfo View;
+
+	for (int32 Frame = 0; Frame < TotalFrames; ++Frame)
+	{
+		// Pawn 沿圆周运动，让平滑、碰撞等阶段处于工作状态
+		const float Angle = Frame * Config.DeltaTime;
+		Actors.Pawn->SetActorLocation(FVector(FMath::Cos(Angle) * 500.0f, FMath::Sin(Angle) * 500.0f, 0.0f));
+
+		const uint64 AllocsBefore = FNamiCameraAllocAudit::GetAllocationCallCount();
+		const uint64 CyclesBefore = FPlatformTime::Cycles64();
+
+		CameraComp->GetCameraView(Config.DeltaTime, View);
+
+		const uint64 CyclesAfter = FPlatformTime::Cycles64();
+		const uint64 AllocsAfter = FNamiCameraAllocAudit::GetAllocationCallCount();
+
+		if (Frame >= Config.WarmupFrames)
+		{
+			Samples.Add((CyclesAfter - CyclesBefore) * NsPerCycle);
+			AllocCalls += AllocsAfter - AllocsBefore;
+		}
+	}
+
+	CameraComp->DestroyComponent();
+	Actors.Destroy();
+
+	double Total = 0.0;
+	for (const double Sample : Samples)
+	{
+		Total += Sample;
+	}
+	Samples.Sort();
+
+	OutResult.Name = Config.Name;
+	OutResult.Frames = Samples.Num();
+	OutResult.MeanNs = Total / Samples.Num();
+	OutResult.P50Ns = Percentile(Samples, 0.50);
+	OutResult.P99Ns = Percentile(Samples, 0.99);
+	OutResult.MaxNs = Samples.Last();
+#if !UE_BUILD_SHIPPING
+	OutResult.AllocsPerFrame = static_cast<double>(AllocCalls) / Samples.Num();
+#endif
+	return true;
+}
+
+FString FNamiCameraBenchmark::ResultsToJson(const TArray<FNamiCameraBenchmarkResult>& Results)
+{
+	FString Json = TEXT("{\"scenarios\":[");
+	for (int32 Index = 0; Index < Results.Num(); ++Index)
+	{
+		if (Index > 0)
+		{
+			Json += TEXT(",");
+		}
+		Json += Results[Index].ToJson();
+	}
+	Json += TEXT("]}");
+	return Json;
+}
+
+// ========== 控制台命令 ==========
+
+static FAutoConsoleCommandWithWorldAndArgs GNamiCameraBenchmarkCommand(
+	TEXT("NamiCamera.Benchmark"),
+	TEXT("运行相机管线基准测试并输出 JSON。参数：Mode=ThirdPerson|DualFocus|TopDown|All Frames=N Depth=N Adjusts=N Components=N Collision=0|1|Both Out=路径"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		using namespace NamiCameraBenchmark_Impl;
+
+		if (!World || !World->IsGameWorld())
+		{
+			UE_LOG(LogNamiCamera, Error, TEXT("[NamiCamera.Benchmark] Requires a game world"));
+			return;
+		}
+
+		const FString CmdLine = FString::Join(Args, TEXT(" "));
+
+		FString ModeArg = TEXT("All");
+		FString CollisionArg = TEXT("Both");
+		FString OutPath = FPaths::ProjectSavedDir() / TEXT("NamiCamera") / TEXT("Benchmark.json");
+		FParse::Value(*CmdLine, TEXT("Mode="), ModeArg);
+		FParse::Value(*CmdLine, TEXT("Collision="), CollisionArg);
+		FParse::Value(*CmdLine, TEXT("Out="), OutPath);
+
+		FNamiCameraBenchmarkConfig BaseConfig;
+		FParse::Value(*CmdLine, TEXT("Frames="), BaseConfig.Frames);
+		FParse::Value(*CmdLine, TEXT("Depth="), BaseConfig.StackDepth);
+		FParse::Value(*CmdLine, TEXT("Adjusts="), BaseConfig.AdjustCount);
+		FParse::Value(*CmdLine, TEXT("Components="), BaseConfig.ExtraComponentCount);
+
+		TArray<FString> ModeNames;
+		if (ModeArg.Equals(TEXT("All"), ESearchCase::IgnoreCase))
+		{
+			ModeNames = { TEXT("ThirdPerson"), TEXT("DualFocus"), TEXT("TopDown") };
+		}
+		else
+		{
+			ModeNames.Add(ModeArg);
+		}
+
+		TArray<bool> CollisionValues;
+		if (CollisionArg.Equals(TEXT("Both"), ESearchCase::IgnoreCase))
+		{
+			CollisionValues = { false, true };
+		}
+		else
+		{
+			CollisionValues.Add(CollisionArg.ToBool());
+		}
+
+		TArray<FNamiCameraBenchmarkResult> Results;
+		for (const FString& ModeName : ModeNames)
+		{
+			for (const bool bCollision : CollisionValues)
+			{
+				FNamiCameraBenchmarkConfig Config = BaseConfig;
+				Config.ModeClass = ParseModeClass(ModeName);
+				Config.bCollision = bCollision;
+				Config.Name = FString::Printf(TEXT("%s_D%d_A%d_C%d_%s"), *ModeName, Config.StackDepth,
+					Config.AdjustCount, Config.ExtraComponentCount, bCollision ? TEXT("Collision") : TEXT("NoCollision"));
+
+				FNamiCameraBenchmarkResult Result;
+				if (FNamiCameraBenchmark::RunScenario(World, Config, Result))
+				{
+					UE_LOG(LogNamiCamera, Display, TEXT("[NamiCamera.Benchmark] %s"), *Result.ToJson());
+					Results.Add(MoveTemp(Result));
+				}
+			}
+		}
+
+		const FString Json = FNamiCameraBenchmark::ResultsToJson(Results);
+		if (FFileHelper::SaveStringToFile(Json, *OutPath))
+		{
+			UE_LOG(LogNamiCamera, Display, TEXT("[NamiCamera.Benchmark] Wrote %d scenarios to %s"), Results.Num(), *OutPath);
+		}
+		else
+		{
+			UE_LOG(LogNamiCamera, Error, TEXT("[NamiCamera.Benchmark] Failed to write %s"), *OutPath);
+		}
+	}));
@@ -0,0 +1,263 @@
+// Copyright Qiu, Inc. All Rights Reserved.
+
+#include "Core/NamiCameraBlendKernel.h"
+
+#include "Core/NamiCameraMath.h"
+#include "Core/NamiCameraState.h"
+#include "Core/NamiCameraView.h"
+
+namespace NamiCameraBlendKernel_Impl
+{
+	/** 按贡献加权平均各层 PivotLocation；所有贡献为 0 时使用栈底 */
+	static FVector BlendPivotLocation(TConstArrayView<const FNamiCameraView*> Views, TConstArrayView<float> Contributions)
+	{
+		VectorRegister4Double PivotSum = VectorZeroDouble();
+		double TotalContribution = 0.0;
+		for (int32 Index = 0; Index < Views.Num(); ++Index)
+		{
+			const float Contribution = Contributions[Index];
+			if (Contribution > 0.0f)
+			{
+				PivotSum = VectorMultiplyAdd(VectorLoadFloat3_W0(&Views[Index]->PivotLocation.X), VectorSetFloat1(static_cast<double>(Contribution)), PivotSum);
+				TotalContribution += Contribution;
+			}
+		}
+
+		if (TotalContribution <= 0.0)
+		{
+			return Views.Last()->PivotLocation;
+		}
+
+		FVector Result;
+		VectorStoreFloat3(VectorMultiply(PivotSum, VectorSetFloat1(1.0 / TotalContribution)), &Result.X);
+		return Result;
+	}
+
+	/** 四元数与参考不在同一半球时取反权重（q 与 -q 表示同一旋转） */
+	static double AlignedWeight(const FQuat& Quat, const FQuat& Reference, double Weight)
+	{
+		return (Quat | Reference) < 0.0 ? -Weight : Weight;
+	}
+
+	/** 取出累加的四元数并归一化，退化时使用 Fallback */
+	static FQuat StoreNormalizedQuat(const VectorRegister4Double& QuatSum, const FQuat& Fallback)
+	{
+		FQuat Result;
+		VectorStore(QuatSum, &Result.X);
+		const double SizeSquared = Result.SizeSquared();
+		return SizeSquared > KINDA_SMALL_NUMBER ? Result * FMath::InvSqrt(SizeSquared) : Fallback;
+	}
+}
+
+void FNamiCameraBlendKernel::Blend(TConstArrayView<const FNamiCameraView*> Views, TConstArrayView<float> Contributions, FNamiCameraView& OutView)
+{
+	using namespace NamiCameraBlendKernel_Impl;
+
+	const int32 NumLayers = Views.Num();
+	check(Contributions.Num() == NumLayers);
+	if (NumLayers <= 0)
+	{
+		return;
+	}
+
+	const int32 BaseIndex = NumLayers - 1;
+	const FVector BlendedPivotLocation = BlendPivotLocation(Views, Contributions);
+
+	// ========== 最终权重 ==========
+	// 顺序混合中第 i 层以贡献 c_i 插值，之后每个更靠近栈顶的层再按 (1 - c_j) 衰减它；栈底为剩余部分
+	TArray<double, TInlineAllocator<8>> Weights;
+	Weights.SetNumUninitialized(NumLayers);
+	double Remaining = 1.0;
+	int32 NumWeighted = 0;
+	int32 SoleIndex = BaseIndex;
+	for (int32 Index = 0; Index < BaseIndex; ++Index)
+	{
+		const double Contribution = FMath::Clamp(Contributions[Index], 0.0f, 1.0f);
+		Weights[Index] = Contribution * Remaining;
+		Remaining *= 1.0 - Contribution;
+		if (Weights[Index] > 0.0)
+		{
+			++NumWeighted;
+			SoleIndex = Index;
+		}
+	}
+	Weights[BaseIndex] = Remaining;
+	if (Remaining > 0.0)
+	{
+		++NumWeighted;
+		SoleIndex = BaseIndex;
+	}
+
+	// 只有一层参与时直接复制，避免四元数往返带来的误差
+	if (NumWeighted <= 1)
+	{
+		OutView = *Views[SoleIndex];
+		OutView.PivotLocation = BlendedPivotLocation;
+		return;
+	}
+
+	// ========== 一次遍历加权累加 ==========
+	const FNamiCameraView& BaseView = *Views[BaseIndex];
+	const FQuat BaseCameraQuat = BaseView.CameraRotation.Quaternion();
+	const FQuat BaseControlQuat = BaseView.ControlRotation.Quaternion();
+
+	VectorRegister4Double ArmDirectionSum = VectorZeroDouble();
+	VectorRegister4Double CameraQuatSum = VectorZeroDouble();
+	VectorRegister4Double ControlQuatSum = VectorZeroDouble();
+	VectorRegister4Double ControlLocationSum = VectorZeroDouble();
+	VectorRegister4Double ScalarSum = VectorZeroDouble(); // (吊臂长度, FOV, 0, 0)
+
+	for (int32 Index = 0; Index < NumLayers; ++Index)
+	{
+		const double Weight = Weights[Index];
+		if (Weight <= 0.0)
+		{
+			continue;
+		}
+
+		const FNamiCameraView& View = *Views[Index];
+		const VectorRegister4Double WeightRegister = VectorSetFloat1(Weight);
+
+		// 吊臂：相对混合后 Pivot 的方向与长度
+		const FVector Arm = View.CameraLocation - BlendedPivotLocation;
+		const double ArmLength = Arm.Size();
+		const FVector ArmDirection = ArmLength > KINDA_SMALL_NUMBER ? Arm / ArmLength : FVector::ForwardVector;
+		ArmDirectionSum = VectorMultiplyAdd(VectorLoadFloat3_W0(&ArmDirection.X), WeightRegister, ArmDirectionSum);
+
+		const FQuat CameraQuat = View.CameraRotation.Quaternion();
+		CameraQuatSum = VectorMultiplyAdd(VectorLoad(&CameraQuat.X), VectorSetFloat1(AlignedWeight(CameraQuat, BaseCameraQuat, Weight)), CameraQuatSum);
+
+		const FQuat ControlQuat = View.ControlRotation.Quaternion();
+		ControlQuatSum = VectorMultiplyAdd(VectorLoad(&ControlQuat.X), VectorSetFloat1(AlignedWeight(ControlQuat, BaseControlQuat, Weight)), ControlQuatSum);
+
+		ControlLocationSum = VectorMultiplyAdd(VectorLoadFloat3_W0(&View.ControlLocation.X), WeightRegister, ControlLocationSum);
+		ScalarSum = VectorMultiplyAdd(MakeVectorRegisterDouble(ArmLength, static_cast<double>(View.FOV), 0.0, 0.0), WeightRegister, ScalarSum);
+	}
+
+	// ========== 归一化并写出 ==========
+	double Scalars[4];
+	VectorStore(ScalarSum, Scalars);
+
+	FVector ArmDirection;
+	VectorStoreFloat3(ArmDirectionSum, &ArmDirection.X);
+	ArmDirection = ArmDirection.GetSafeNormal();
+	if (ArmDirection.IsZero())
+	{
+		ArmDirection = (BaseView.CameraLocation - BlendedPivotLocation).GetSafeNormal();
+	}
+
+	OutView.PivotLocation = BlendedPivotLocation;
+	OutView.CameraLocation = BlendedPivotLocation + ArmDirection * Scalars[0];
+	OutView.CameraRotation = FNamiCameraMath::NormalizeRotatorTo360(StoreNormalizedQuat(CameraQuatSum, BaseCameraQuat).Rotator());
+	VectorStoreFloat3(ControlLocationSum, &OutView.ControlLocation.X);
+	OutView.ControlRotation = FNamiCameraMath::NormalizeRotatorTo360(StoreNormalizedQuat(ControlQuatSum, BaseControlQuat).Rotator());
+	OutView.FOV = static_cast<float>(Scalars[1]);
+}
+
+void FNamiCameraBlendKernel::BlendSequential(TConstArrayView<const FNamiCameraView*> Views, TConstArrayView<float> Contributions, FNamiCameraView& OutView)
+{
+	const int32 NumLayers = Views.Num();
+	check(Contributions.Num() == NumLayers);
+	if (NumLayers <= 0)
+	{
+		return;
+	}
+
+	// ========== 阶段1: PivotLocation 混合 ==========
+	FVector BlendedPivotLocation = FVector::ZeroVector;
+	float TotalWeight = 0.0f;
+
+	// 从栈底到栈顶遍历
+	for (int32 Index = NumLayers - 1; Index >= 0; --Index)
+	{
+		const float ModeWeight = Contributions[Index];
+		if (ModeWeight > 0.0f)
+		{
+			const FVector ModePivotLocation = Views[Index]->PivotLocation;
+			if (TotalWeight <= 0.0f)
+			{
+				// 第一个有效权重，直接设置
+				BlendedPivotLocation = ModePivotLocation;
+				TotalWeight = ModeWeight;
+			}
+			else
+			{
+				// 线性插值混合
+				const float BlendAlpha = ModeWeight / (TotalWeight + ModeWeight);
+				BlendedPivotLocation = FMath::Lerp(BlendedPivotLocation, ModePivotLocation, BlendAlpha);
+				TotalWeight += ModeWeight;
+			}
+		}
+	}
+
+	// 如果所有权重都为 0，使用栈底的 PivotLocation
+	if (TotalWeight <= 0.0f)
+	{
+		BlendedPivotLocation = Views[NumLayers - 1]->PivotLocation;
+	}
+
+	// ========== 阶段2: 混合完整 View ==========
+	OutView = *Views[NumLayers - 1];
+	OutView.PivotLocation = BlendedPivotLocation;
+
+	// 混合其他层的 View（从栈底到栈顶，跳过栈底）
+	for (int32 Index = NumLayers - 2; Index >= 0; --Index)
+	{
+		const float ModeWeight = Contributions[Index];
+		if (ModeWeight > 0.0f)
+		{
+			// 混合 View（但 PivotLocation 已经混合好了）
+			FNamiCameraView OtherView = *Views[Index];
+			OtherView.PivotLocation = BlendedPivotLocation;
+			OutView.Blend(OtherView, ModeWeight);
+
+			// 确保 PivotLocation 保持为混合后的值
+			OutView.PivotLocation = BlendedPivotLocation;
+		}
+	}
+}
+
+void FNamiCameraBlendKernel::BlendStates(TConstArrayView<const FNamiCameraState*> States, TConstArrayView<const FNamiCameraView*> Views,
+	TConstArrayView<float> Contributions, FNamiCameraState& OutState, FNamiCameraView& OutView)
+{
+	const int32 NumLayers = States.Num();
+	check(Views.Num() == NumLayers && Contributions.Num() == NumLayers);
+	if (NumLayers <= 0)
+	{
+		return;
+	}
+
+	// 只混合输入参数，输出由 ComputeOutput 统一计算
+	FNamiCameraStateFlags InputMask(false);
+	InputMask.SetAllInput(true);
+
+	const int32 BaseIndex = NumLayers - 1;
+	check(States[BaseIndex]);
+	OutState = *States[BaseIndex];
+	FVector ControlLocation = Views[BaseIndex]->ControlLocation;
+	FRotator ControlRotation = Views[BaseIndex]->ControlRotation;
+
+	// 从栈底到栈顶，与 BlendSequential 的混合顺序一致
+	for (int32 Index = BaseIndex - 1; Index >= 0; --Index)
+	{
+		const float Contribution = Contributions[Index];
+		if (Contribution <= 0.0f)
+		{
+			continue;
+		}
+
+		check(States[Index]);
+		OutState.LerpChanged(*States[Index], Contribution, InputMask);
+		ControlLocation = FMath::Lerp(ControlLocation, Views[Index]->ControlLocation, Contribution);
+		ControlRotation = FMath::Lerp(ControlRotation, Views[Index]->ControlRotation, Contribution);
+	}
+
+	OutState.ComputeOutput();
+
+	OutView.PivotLocation = OutState.PivotLocation;
+	OutView.CameraLocation = OutState.CameraLocation;
+	OutView.CameraRotation = FNamiCameraMath::NormalizeRotatorTo360(OutState.CameraRotation);
+	OutView.ControlLocation = ControlLocation;
+	OutView.ControlRotation = FNamiCameraMath::NormalizeRotatorTo360(ControlRotation);
+	OutView.FOV = OutState.FieldOfView;
+}
@@ -0,0 +1,211 @@
+// Copyright Qiu, Inc. All Rights Reserved.
+
+#include "Core/NamiCameraCurveCache.h"
+
+#include "Curves/CurveFloat.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace NamiCameraCurveCache_Impl
+{
+	/** 曲线 -> 查找表（弱引用，生命周期由持有者决定） */
+	static TMap<TObjectKey<UCurveFloat>, TWeakPtr<FNamiCameraCurveLUT>> GCache;
+
+	/** 缓存条目数超过该值时清理已释放的条目 */
+	static int32 GPruneThreshold = 64;
+
+#if WITH_EDITOR
+	static FDelegateHandle GObjectModifiedHandle;
+	static FDelegateHandle GObjectPropertyChangedHandle;
+
+	static void OnObjectModified(UObject* Object)
+	{
+		if (const UCurveFloat* Curve = Cast<UCurveFloat>(Object))
+		{
+			FNamiCameraCurveCache::Invalidate(Curve);
+		}
+	}
+
+	static void OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+	{
+		OnObjectModified(Object);
+	}
+#endif
+
+	static void PruneExpired()
+	{
+		for (auto It = GCache.CreateIterator(); It; ++It)
+		{
+			if (!It->Value.IsValid())
+			{
+				It.RemoveCurrent();
+			}
+		}
+		GPruneThreshold = FMath::Max(64, GCache.Num() * 2);
+	}
+}
+
+// ========== FNamiCameraCurveLUT ==========
+
+FNamiCameraCurveLUT::FNamiCameraCurveLUT(const UCurveFloat* InCurve)
+	: Curve(InCurve)
+{
+	check(InCurve);
+
+	InCurve->GetTimeRange(MinTime, MaxTime);
+	bConstantPreInfinity = InCurve->FloatCurve.PreInfinityExtrap == RCCE_Constant;
+	bConstantPostInfinity = InCurve->FloatCurve.PostInfinityExtrap == RCCE_Constant;
+
+	if (MaxTime > MinTime)
+	{
+		Samples.SetNumUninitialized(Resolution + 1);
+		const float Step = (MaxTime - MinTime) / Resolution;
+		for (int32 Index = 0; Index <= Resolution; ++Index)
+		{
+			Samples[Index] = InCurve->GetFloatValue(MinTime + Step * Index);
+		}
+		SamplesPerSecond = Resolution / (MaxTime - MinTime);
+	}
+	else
+	{
+		// 没有或只有一个关键帧：常量曲线
+		Samples.Add(InCurve->GetFloatValue(MinTime));
+		bConstantPreInfinity = true;
+		bConstantPostInfinity = true;
+	}
+}
+
+float FNamiCameraCurveLUT::Evaluate(float Time) const
+{
+	if (Time <= MinTime || Samples.Num() == 1)
+	{
+		if (Time < MinTime && !bConstantPreInfinity)
+		{
+			const UCurveFloat* SourceCurve = Curve.Get();
+			return SourceCurve ? SourceCurve->GetFloatValue(Time) : Samples[0];
+		}
+		return Samples[0];
+	}
+	if (Time >= MaxTime)
+	{
+		if (Time > MaxTime && !bConstantPostInfinity)
+		{
+			const UCurveFloat* SourceCurve = Curve.Get();
+			return SourceCurve ? SourceCurve->GetFloatValue(Time) : Samples.Last();
+		}
+		return Samples.Last();
+	}
+	return Sample((Time - MinTime) * SamplesPerSecond);
+}
+
+float FNamiCameraCurveLUT::EvaluateNormalized(float Alpha) const
+{
+	if (Alpha > 0.0f && Alpha < 1.0f && Samples.Num() > 1)
+	{
+		return Sample(Alpha * Resolution);
+	}
+	return Evaluate(MinTime + (MaxTime - MinTime) * Alpha);
+}
+
+float FNamiCameraCurveLUT::Sample(float Position) const
+{
+	const int32 Index = FMath::Clamp(FMath::FloorToInt(Position), 0, Resolution - 1);
+	const float Fraction = Position - Index;
+	return FMath::Lerp(Samples[Index], Samples[Index + 1], Fraction);
+}
+
+// ========== FNamiCameraCurveCache ==========
+
+TSharedPtr<const FNamiCameraCurveLUT> FNamiCameraCurveCache::Acquire(const UCurveFloat* Curve)
+{
+	using namespace NamiCameraCurveCache_Impl;
+	check(IsInGameThread());
+
+	if (!Curve)
+	{
+		return nullptr;
+	}
+
+	TWeakPtr<FNamiCameraCurveLUT>& Entry = GCache.FindOrAdd(TObjectKey<UCurveFloat>(Curve));
+	if (TSharedPtr<FNamiCameraCurveLUT> Existing = Entry.Pin())
+	{
+		if (!Existing->bStale)
+		{
+			return Existing;
+		}
+	}
+
+	TSharedRef<FNamiCameraCurveLUT> LUT = MakeShared<FNamiCameraCurveLUT>(Curve);
+	Entry = LUT;
+
+	if (GCache.Num() > GPruneThreshold)
+	{
+		PruneExpired();
+	}
+	return LUT;
+}
+
+void FNamiCameraCurveCache::Invalidate(const UCurveFloat* Curve)
+{
+	using namespace NamiCameraCurveCache_Impl;
+
+	TWeakPtr<FNamiCameraCurveLUT> Entry;
+	if (GCache.RemoveAndCopyValue(TObjectKey<UCurveFloat>(Curve), Entry))
+	{
+		if (TSharedPtr<FNamiCameraCurveLUT> LUT = Entry.Pin())
+		{
+			LUT->bStale = true;
+		}
+	}
+}
+
+void FNamiCameraCurveCache::Startup()
+{
+#if WITH_EDITOR
+	using namespace NamiCameraCurveCache_Impl;
+	// Modify 在修改前触发，PropertyChanged 在修改后触发；两者都失效，保证下次求值取到修改后的曲线
+	GObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddStatic(&OnObjectModified);
+	GObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddStatic(&OnObjectPropertyChanged);
+#endif
+}
+
+void FNamiCameraCurveCache::Shutdown()
+{
+	using namespace NamiCameraCurveCache_Impl;
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectModified.Remove(GObjectModifiedHandle);
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(GObjectPropertyChangedHandle);
+#endif
+	GCache.Reset();
+}
+
+// ========== FNamiCameraCurveLUTRef ==========
+
+const FNamiCameraCurveLUT* FNamiCameraCurveLUTRef::Resolve(const UCurveFloat* Curve) const
+{
+	if (!LUT.IsValid() || LUT->IsStale() || LUT->GetCurve() != Curve)
+	{
+		LUT = FNamiCameraCurveCache::Acquire(Curve);
+	}
+	return LUT.Get();
+}
+
+float FNamiCameraCurveLUTRef::Evaluate(const UCurveFloat* Curve, float Time) const
+{
+	if (!Curve)
+	{
+		return Time;
+	}
+	const FNamiCameraCurveLUT* Table = Resolve(Curve);
+	return Table ? Table->Evaluate(Time) : Curve->GetFloatValue(Time);
+}
+
+float FNamiCameraCurveLUTRef::EvaluateNormalized(const UCurveFloat* Curve, float Alpha) const
+{
+	if (!Curve)
+	{
+		return Alpha;
+	}
+	const FNamiCameraCurveLUT* Table = Resolve(Curve);
+	return Table ? Table->EvaluateNormalized(Alpha) : Alpha;
+}
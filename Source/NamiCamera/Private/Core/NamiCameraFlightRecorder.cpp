@@ -0,0 +1,301 @@
+// Copyright Qiu, Inc. All Rights Reserved.
+
+#include "Core/NamiCameraFlightRecorder.h"
+
+#include "Async/Async.h"
+#include "Core/LogNamiCamera.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace NamiCameraFlightRecorder_Impl
+{
+	static constexpr int32 NumStages = static_cast<int32>(ENamiCameraFlightStage::Count);
+
+	static const TCHAR* StageNames[NumStages] =
+	{
+		TEXT("PreProcess"),
+		TEXT("ModeStack"),
+		TEXT("CameraAdjust"),
+		TEXT("ControllerSync"),
+		TEXT("Smoothing"),
+		TEXT("PostProcess"),
+	};
+
+	// 二进制中统一以 float 存储，保持文件紧凑
+
+	static void SerializeVector(FArchive& Ar, FVector& Value)
+	{
+		float X = Value.X, Y = Value.Y, Z = Value.Z;
+		Ar << X << Y << Z;
+		Value = FVector(X, Y, Z);
+	}
+
+	static void SerializeRotator(FArchive& Ar, FRotator& Value)
+	{
+		float Pitch = Value.Pitch, Yaw = Value.Yaw, Roll = Value.Roll;
+		Ar << Pitch << Yaw << Roll;
+		Value = FRotator(Pitch, Yaw, Roll);
+	}
+
+	static void SerializeView(FArchive& Ar, FNamiCameraView& View)
+	{
+		SerializeVector(Ar, View.PivotLocation);
+		SerializeVector(Ar, View.CameraLocation);
+		SerializeRotator(Ar, View.CameraRotation);
+		SerializeVector(Ar, View.ControlLocation);
+		SerializeRotator(Ar, View.ControlRotation);
+		Ar << View.FOV;
+	}
+
+	static void SerializeRecord(FArchive& Ar, FNamiCameraFlightRecord& Record)
+	{
+		Ar << Record.FrameNumber;
+		Ar << Record.WorldTime;
+		Ar << Record.DeltaTime;
+		Ar << Record.TotalMs;
+		for (int32 Stage = 0; Stage < NumStages; ++Stage)
+		{
+			Ar << Record.StageMs[Stage];
+		}
+		SerializeView(Ar, Record.BaseView);
+		SerializeView(Ar, Record.AdjustedView);
+		SerializeVector(Ar, Record.ControlLocation);
+		SerializeRotator(Ar, Record.ControlRotation);
+		SerializeVector(Ar, Record.SmoothedLocation);
+		SerializeRotator(Ar, Record.SmoothedRotation);
+		Ar << Record.SmoothedFOV;
+		Ar << Record.NumModeWeights;
+		Record.NumModeWeights = FMath::Min<uint8>(Record.NumModeWeights, FNamiCameraFlightRecord::MaxModeWeights);
+		for (int32 Index = 0; Index < Record.NumModeWeights; ++Index)
+		{
+			Ar << Record.ModeWeights[Index];
+		}
+	}
+
+	static void AppendViewCsvHeader(FString& Out, const TCHAR* Prefix)
+	{
+		Out += FString::Printf(
+			TEXT(",%s_PivotX,%s_PivotY,%s_PivotZ,%s_LocX,%s_LocY,%s_LocZ,%s_Pitch,%s_Yaw,%s_Roll,%s_CtrlX,%s_CtrlY,%s_CtrlZ,%s_CtrlPitch,%s_CtrlYaw,%s_CtrlRoll,%s_FOV"),
+			Prefix, Prefix, Prefix, Prefix, Prefix, Prefix, Prefix, Prefix, Prefix, Prefix, Prefix, Prefix, Prefix, Prefix, Prefix, Prefix);
+	}
+
+	static void AppendViewCsv(FString& Out, const FNamiCameraView& View)
+	{
+		Out += FString::Printf(TEXT(",%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f"),
+			View.PivotLocation.X, View.PivotLocation.Y, View.PivotLocation.Z,
+			View.CameraLocation.X, View.CameraLocation.Y, View.CameraLocation.Z,
+			View.CameraRotation.Pitch, View.CameraRotation.Yaw, View.CameraRotation.Roll,
+			View.ControlLocation.X, View.ControlLocation.Y, View.ControlLocation.Z,
+			View.ControlRotation.Pitch, View.ControlRotation.Yaw, View.ControlRotation.Roll,
+			View.FOV);
+	}
+}
+
+void FNamiCameraFlightRecorder::Initialize(int32 InCapacity)
+{
+	Records.Reset();
+	Records.SetNum(FMath::Max(InCapacity, 0));
+	WriteIndex = 0;
+	NumRecords = 0;
+	CurrentRecord = nullptr;
+}
+
+FNamiCameraFlightRecord* FNamiCameraFlightRecorder::BeginFrame(uint64 FrameNumber, double WorldTime, float DeltaTime)
+{
+	FrameStartCycles = FPlatformTime::Cycles64();
+	LastStageCycles = FrameStartCycles;
+	FMemory::Memzero(PendingStageMs);
+
+	if (!IsEnabled())
+	{
+		CurrentRecord = nullptr;
+		return nullptr;
+	}
+
+	CurrentRecord = &Records[WriteIndex];
+	*CurrentRecord = FNamiCameraFlightRecord();
+	CurrentRecord->FrameNumber = FrameNumber;
+	CurrentRecord->WorldTime = WorldTime;
+	CurrentRecord->DeltaTime = DeltaTime;
+	return CurrentRecord;
+}
+
+void FNamiCameraFlightRecorder::MarkStage(ENamiCameraFlightStage Stage)
+{
+	if (FrameStartCycles == 0)
+	{
+		return;
+	}
+
+	const uint64 Now = FPlatformTime::Cycles64();
+	PendingStageMs[static_cast<int32>(Stage)] = static_cast<float>(FPlatformTime::ToMilliseconds64(Now - LastStageCycles));
+	LastStageCycles = Now;
+}
+
+void FNamiCameraFlightRecorder::CancelFrame()
+{
+	FrameStartCycles = 0;
+	CurrentRecord = nullptr;
+}
+
+float FNamiCameraFlightRecorder::EndFrame()
+{
+	if (FrameStartCycles == 0)
+	{
+		return 0.0f;
+	}
+
+	LastTotalMs = static_cast<float>(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - FrameStartCycles));
+	FMemory::Memcpy(LastStageMs, PendingStageMs, sizeof(LastStageMs));
+	FrameStartCycles = 0;
+
+	if (CurrentRecord)
+	{
+		CurrentRecord->TotalMs = LastTotalMs;
+		FMemory::Memcpy(CurrentRecord->StageMs, PendingStageMs, sizeof(CurrentRecord->StageMs));
+
+		WriteIndex = (WriteIndex + 1) % Records.Num();
+		NumRecords = FMath::Min(NumRecords + 1, Records.Num());
+		CurrentRecord = nullptr;
+	}
+	return LastTotalMs;
+}
+
+void FNamiCameraFlightRecorder::Serialize(TArray<uint8>& OutBytes) const
+{
+	using namespace NamiCameraFlightRecorder_Impl;
+
+	FMemoryWriter Writer(OutBytes);
+
+	uint32 Magic = FileMagic;
+	uint32 Version = FileVersion;
+	uint32 StageCount = NumStages;
+	uint32 Count = NumRecords;
+	Writer << Magic << Version << StageCount << Count;
+
+	// 从最旧的记录开始按时间顺序写出
+	const int32 Capacity = Records.Num();
+	const int32 OldestIndex = NumRecords < Capacity ? 0 : WriteIndex;
+	for (int32 Offset = 0; Offset < NumRecords; ++Offset)
+	{
+		FNamiCameraFlightRecord Record = Records[(OldestIndex + Offset) % Capacity];
+		SerializeRecord(Writer, Record);
+	}
+}
+
+void FNamiCameraFlightRecorder::DumpToFile(const FString& FilePath) const
+{
+	if (NumRecords == 0)
+	{
+		return;
+	}
+
+	// 游戏线程只做序列化，文件写入放到线程池
+	TArray<uint8> Bytes;
+	Serialize(Bytes);
+
+	Async(EAsyncExecution::ThreadPool, [Bytes = MoveTemp(Bytes), FilePath]()
+	{
+		if (FFileHelper::SaveArrayToFile(Bytes, *FilePath))
+		{
+			UE_LOG(LogNamiCamera, Log, TEXT("[FNamiCameraFlightRecorder] Dumped %d bytes to %s"), Bytes.Num(), *FilePath);
+		}
+		else
+		{
+			UE_LOG(LogNamiCamera, Error, TEXT("[FNamiCameraFlightRecorder] Failed to write %s"), *FilePath);
+		}
+	});
+}
+
+bool FNamiCameraFlightRecorder::ConvertToCsv(const FString& InFilePath, const FString& OutCsvPath)
+{
+	using namespace NamiCameraFlightRecorder_Impl;
+
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *InFilePath))
+	{
+		UE_LOG(LogNamiCamera, Error, TEXT("[FNamiCameraFlightRecorder::ConvertToCsv] Failed to read %s"), *InFilePath);
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+	uint32 Magic = 0, Version = 0, StageCount = 0, Count = 0;
+	Reader << Magic << Version << StageCount << Count;
+	if (Magic != FileMagic || Version != FileVersion || StageCount != NumStages)
+	{
+		UE_LOG(LogNamiCamera, Error, TEXT("[FNamiCameraFlightRecorder::ConvertToCsv] %s is not a supported flight recorder file"), *InFilePath);
+		return false;
+	}
+
+	FString Csv = TEXT("Frame,WorldTime,DeltaTime,TotalMs");
+	for (int32 Stage = 0; Stage < NumStages; ++Stage)
+	{
+		Csv += FString::Printf(TEXT(",%sMs"), StageNames[Stage]);
+	}
+	AppendViewCsvHeader(Csv, TEXT("Base"));
+	AppendViewCsvHeader(Csv, TEXT("Adjusted"));
+	Csv += TEXT(",CtrlX,CtrlY,CtrlZ,CtrlPitch,CtrlYaw,CtrlRoll,SmoothX,SmoothY,SmoothZ,SmoothPitch,SmoothYaw,SmoothRoll,SmoothFOV,NumModes");
+	for (int32 Index = 0; Index < FNamiCameraFlightRecord::MaxModeWeights; ++Index)
+	{
+		Csv += FString::Printf(TEXT(",Weight%d"), Index);
+	}
+	Csv += LINE_TERMINATOR;
+
+	for (uint32 RecordIndex = 0; RecordIndex < Count && !Reader.IsError(); ++RecordIndex)
+	{
+		FNamiCameraFlightRecord Record;
+		SerializeRecord(Reader, Record);
+
+		Csv += FString::Printf(TEXT("%llu,%.4f,%.5f,%.4f"), Record.FrameNumber, Record.WorldTime, Record.DeltaTime, Record.TotalMs);
+		for (int32 Stage = 0; Stage < NumStages; ++Stage)
+		{
+			Csv += FString::Printf(TEXT(",%.4f"), Record.StageMs[Stage]);
+		}
+		AppendViewCsv(Csv, Record.BaseView);
+		AppendViewCsv(Csv, Record.AdjustedView);
+		Csv += FString::Printf(TEXT(",%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%d"),
+			Record.ControlLocation.X, Record.ControlLocation.Y, Record.ControlLocation.Z,
+			Record.ControlRotation.Pitch, Record.ControlRotation.Yaw, Record.ControlRotation.Roll,
+			Record.SmoothedLocation.X, Record.SmoothedLocation.Y, Record.SmoothedLocation.Z,
+			Record.SmoothedRotation.Pitch, Record.SmoothedRotation.Yaw, Record.SmoothedRotation.Roll,
+			Record.SmoothedFOV, Record.NumModeWeights);
+		for (int32 Index = 0; Index < FNamiCameraFlightRecord::MaxModeWeights; ++Index)
+		{
+			Csv += Index < Record.NumModeWeights ? FString::Printf(TEXT(",%.4f"), Record.ModeWeights[Index]) : FString(TEXT(","));
+		}
+		Csv += LINE_TERMINATOR;
+	}
+
+	if (Reader.IsError())
+	{
+		UE_LOG(LogNamiCamera, Error, TEXT("[FNamiCameraFlightRecorder::ConvertToCsv] %s is truncated"), *InFilePath);
+		return false;
+	}
+
+	return FFileHelper::SaveStringToFile(Csv, *OutCsvPath);
+}
+
+// ========== 控制台命令 ==========
+
+static FAutoConsoleCommand GNamiCameraFlightRecorderToCsvCommand(
+	TEXT("NamiCamera.FlightRecorder.ToCsv"),
+	TEXT("将飞行记录器二进制文件转换为 CSV。参数：<输入.ncfr> [输出.csv]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		if (Args.Num() < 1)
+		{
+			UE_LOG(LogNamiCamera, Warning, TEXT("[NamiCamera.FlightRecorder.ToCsv] Usage: NamiCamera.FlightRecorder.ToCsv <File.ncfr> [Out.csv]"));
+			return;
+		}
+
+		const FString& InPath = Args[0];
+		const FString OutPath = Args.Num() > 1 ? Args[1] : FPaths::ChangeExtension(InPath, TEXT("csv"));
+		if (FNamiCameraFlightRecorder::ConvertToCsv(InPath, OutPath))
+		{
+			UE_LOG(LogNamiCamera, Display, TEXT("[NamiCamera.FlightRecorder.ToCsv] Wrote %s"), *OutPath);
+		}
+	}));
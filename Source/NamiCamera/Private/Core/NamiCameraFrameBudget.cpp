@@ -0,0 +1,91 @@
+// Copyright Qiu, Inc. All Rights Reserved.
+
+#include "Core/NamiCameraFrameBudget.h"
+
+#include "HAL/IConsoleManager.h"
+
+namespace NamiCameraFrameBudget_Impl
+{
+	static float GFrameBudgetMsOverride = -1.0f;
+	static FAutoConsoleVariableRef CVarFrameBudgetMs(
+		TEXT("NamiCamera.FrameBudgetMs"),
+		GFrameBudgetMsOverride,
+		TEXT("每个相机 GetCameraView 的耗时预算（毫秒）。-1=跟随组件设置，0=关闭降级，>0=超出后逐级降级"),
+		ECVF_Default);
+
+	static int32 GForceDegradeLevel = -1;
+	static FAutoConsoleVariableRef CVarForceDegradeLevel(
+		TEXT("NamiCamera.FrameBudget.ForceLevel"),
+		GForceDegradeLevel,
+		TEXT("强制相机降级等级（调试用）。-1=按预算自动，0=不降级，1=复用碰撞结果，2=跳过遮挡检测，3=仅评估栈顶模式"),
+		ECVF_Cheat);
+}
+
+float FNamiCameraFrameBudgetGuard::ResolveBudgetMs(float ComponentBudgetMs)
+{
+	using namespace NamiCameraFrameBudget_Impl;
+	return GFrameBudgetMsOverride >= 0.0f ? GFrameBudgetMsOverride : FMath::Max(ComponentBudgetMs, 0.0f);
+}
+
+ENamiCameraDegradeLevel FNamiCameraFrameBudgetGuard::GetLevel() const
+{
+	using namespace NamiCameraFrameBudget_Impl;
+	if (bSuspended)
+	{
+		return ENamiCameraDegradeLevel::None;
+	}
+	if (GForceDegradeLevel >= 0)
+	{
+		return static_cast<ENamiCameraDegradeLevel>(FMath::Min(GForceDegradeLevel, static_cast<int32>(ENamiCameraDegradeLevel::Max)));
+	}
+	return Level;
+}
+
+bool FNamiCameraFrameBudgetGuard::Update(float FrameMs, float BudgetMs, int32 RecoverFrames)
+{
+	const ENamiCameraDegradeLevel OldLevel = Level;
+
+	if (bSuspended || BudgetMs <= 0.0f)
+	{
+		Reset();
+		return Level != OldLevel;
+	}
+
+	if (FrameMs > BudgetMs)
+	{
+		// 超出预算：提升一级，重新累计便宜帧
+		CheapFrames = 0;
+		if (Level < ENamiCameraDegradeLevel::Max)
+		{
+			Level = static_cast<ENamiCameraDegradeLevel>(static_cast<uint8>(Level) + 1);
+		}
+	}
+	else if (FrameMs < BudgetMs * RecoverRatio)
+	{
+		// 连续便宜帧达到阈值：回退一级
+		if (Level != ENamiCameraDegradeLevel::None && ++CheapFrames >= FMath::Max(RecoverFrames, 1))
+		{
+			CheapFrames = 0;
+			Level = static_cast<ENamiCameraDegradeLevel>(static_cast<uint8>(Level) - 1);
+		}
+	}
+	else
+	{
+		// 接近预算：保持当前等级
+		CheapFrames = 0;
+	}
+
+	return Level != OldLevel;
+}
+
+void FNamiCameraFrameBudgetGuard::Reset()
+{
+	Level = ENamiCameraDegradeLevel::None;
+	CheapFrames = 0;
+}
+
+void FNamiCameraFrameBudgetGuard::SetSuspended(bool bInSuspended)
+{
+	bSuspended = bInSuspended;
+	Reset();
+}
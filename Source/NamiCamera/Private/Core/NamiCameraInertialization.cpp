@@ -0,0 +1,119 @@
+// Copyright Qiu, Inc. All Rights Reserved.
+
+#include "Core/NamiCameraInertialization.h"
+
+#include "Core/NamiCameraView.h"
+
+namespace NamiCameraInertialization_Impl
+{
+	/** 取最短路径的四元数 */
+	static FQuat Shortest(const FQuat& Quat)
+	{
+		return Quat.W < 0.0f ? -Quat : Quat;
+	}
+}
+
+void FNamiInertializedScalar::Begin(float InX0, float InV0, float BlendTime)
+{
+	// 统一到正偏移处理，求值时再乘回符号
+	Sign = InX0 < 0.0f ? -1.0f : 1.0f;
+	X0 = InX0 * Sign;
+	V0 = InV0 * Sign;
+	Duration = 0.0f;
+	A = B = C = HalfA0 = 0.0f;
+
+	if (X0 <= KINDA_SMALL_NUMBER || BlendTime <= 0.0f)
+	{
+		X0 = 0.0f;
+		return;
+	}
+
+	// 偏移正在增大时不保留该速度分量，否则衰减曲线会先冲出再回落
+	V0 = FMath::Min(V0, 0.0f);
+
+	// 偏移快速减小时缩短时长，保证曲线不越过 0
+	float T = BlendTime;
+	if (V0 < 0.0f)
+	{
+		T = FMath::Min(T, -5.0f * X0 / V0);
+	}
+	Duration = T;
+
+	const float T2 = T * T;
+	const float T3 = T2 * T;
+	const float A0 = FMath::Max((-8.0f * V0 * T - 20.0f * X0) / T2, 0.0f);
+	HalfA0 = 0.5f * A0;
+	A = -(A0 * T2 + 6.0f * V0 * T + 12.0f * X0) / (2.0f * T3 * T2);
+	B = (3.0f * A0 * T2 + 16.0f * V0 * T + 30.0f * X0) / (2.0f * T2 * T2);
+	C = -(3.0f * A0 * T2 + 12.0f * V0 * T + 20.0f * X0) / (2.0f * T3);
+}
+
+float FNamiInertializedScalar::Evaluate(float Time) const
+{
+	if (Time >= Duration || X0 == 0.0f)
+	{
+		return 0.0f;
+	}
+	const float X = ((((A * Time + B) * Time + C) * Time + HalfA0) * Time + V0) * Time + X0;
+	return X * Sign;
+}
+
+void FNamiCameraInertializer::Begin(const FNamiCameraView& PrevSource, const FNamiCameraView& Source, float SourceDeltaTime,
+	const FNamiCameraView& Target, float BlendTime)
+{
+	using namespace NamiCameraInertialization_Impl;
+
+	const float InvDeltaTime = SourceDeltaTime > KINDA_SMALL_NUMBER ? 1.0f / SourceDeltaTime : 0.0f;
+
+	// 位置：沿偏移方向衰减，速度取旧相机相对 Pivot 的运动在该方向上的分量
+	const FVector Offset = Source.CameraLocation - Target.CameraLocation;
+	const float Distance = Offset.Size();
+	LocationAxis = Distance > KINDA_SMALL_NUMBER ? Offset / Distance : FVector::ZeroVector;
+	const FVector SourceVelocity = ((Source.CameraLocation - PrevSource.CameraLocation)
+		- (Source.PivotLocation - PrevSource.PivotLocation)) * InvDeltaTime;
+	LocationOffset.Begin(Distance, FVector::DotProduct(SourceVelocity, LocationAxis), BlendTime);
+
+	// 旋转：Source = OffsetQuat * Target，绕固定轴衰减角度
+	const FQuat OffsetQuat = Shortest(Source.CameraRotation.Quaternion() * Target.CameraRotation.Quaternion().Inverse());
+	float OffsetAngle = 0.0f;
+	OffsetQuat.ToAxisAndAngle(RotationAxis, OffsetAngle);
+	const FQuat DeltaQuat = Shortest(Source.CameraRotation.Quaternion() * PrevSource.CameraRotation.Quaternion().Inverse());
+	FVector DeltaAxis;
+	float DeltaAngle = 0.0f;
+	DeltaQuat.ToAxisAndAngle(DeltaAxis, DeltaAngle);
+	const FVector AngularVelocity = DeltaAxis * (DeltaAngle * InvDeltaTime);
+	RotationOffset.Begin(OffsetAngle, FVector::DotProduct(AngularVelocity, RotationAxis), BlendTime);
+
+	// FOV
+	FOVOffset.Begin(Source.FOV - Target.FOV, (Source.FOV - PrevSource.FOV) * InvDeltaTime, BlendTime);
+
+	Elapsed = 0.0f;
+	Duration = FMath::Max3(LocationOffset.GetDuration(), RotationOffset.GetDuration(), FOVOffset.GetDuration());
+	bActive = Duration > 0.0f;
+}
+
+void FNamiCameraInertializer::Apply(float DeltaTime, FNamiCameraView& InOutView)
+{
+	if (!bActive)
+	{
+		return;
+	}
+
+	// 偏移在上一帧时刻取得，本帧先推进再求值，保证首帧沿旧速度继续运动
+	Elapsed += DeltaTime;
+	if (Elapsed >= Duration)
+	{
+		bActive = false;
+		return;
+	}
+
+	InOutView.CameraLocation += LocationAxis * LocationOffset.Evaluate(Elapsed);
+
+	const float Angle = RotationOffset.Evaluate(Elapsed);
+	if (Angle != 0.0f)
+	{
+		InOutView.CameraRotation = (FQuat(RotationAxis, Angle) * InOutView.CameraRotation.Quaternion()).Rotator();
+	}
+
+	InOutView.FOV += FOVOffset.Evaluate(Elapsed);
+}
@@ -0,0 +1,95 @@
+// Copyright Qiu, Inc. All Rights Reserved.
+
+#include "Core/NamiCameraLogFlags.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Settings/NamiCameraSettings.h"
+#include "UObject/UObjectBase.h"
+
+uint32 FNamiCameraLogFlags::Mask = 0;
+
+namespace NamiCameraLogFlags_Impl
+{
+	static void OnLogCVarChanged(IConsoleVariable* Variable)
+	{
+		FNamiCameraLogFlags::Refresh();
+	}
+
+	static int32 GLogStack = -1;
+	static int32 GLogEffect = -1;
+	static int32 GLogState = -1;
+	static int32 GLogComponent = -1;
+	static int32 GLogWarning = -1;
+	static int32 GLogCameraInfo = -1;
+	static int32 GLogModeBlend = -1;
+	static int32 GLogInputInterrupt = -1;
+
+#define NAMI_CAMERA_LOG_CVAR(Name, Variable) \
+	static FAutoConsoleVariableRef CVar##Variable( \
+		TEXT("NamiCamera.Log.") TEXT(Name), \
+		Variable, \
+		TEXT("日志分类开关。-1=跟随项目设置，0=关闭，1=Log，2=屏幕，3=Log+屏幕"), \
+		FConsoleVariableDelegate::CreateStatic(&OnLogCVarChanged), \
+		ECVF_Default)
+
+	NAMI_CAMERA_LOG_CVAR("Stack", GLogStack);
+	NAMI_CAMERA_LOG_CVAR("Effect", GLogEffect);
+	NAMI_CAMERA_LOG_CVAR("State", GLogState);
+	NAMI_CAMERA_LOG_CVAR("Component", GLogComponent);
+	NAMI_CAMERA_LOG_CVAR("Warning", GLogWarning);
+	NAMI_CAMERA_LOG_CVAR("CameraInfo", GLogCameraInfo);
+	NAMI_CAMERA_LOG_CVAR("ModeBlend", GLogModeBlend);
+	NAMI_CAMERA_LOG_CVAR("InputInterrupt", GLogInputInterrupt);
+
+#undef NAMI_CAMERA_LOG_CVAR
+
+	/** 合并设置值与控制台变量覆盖，写入对应的 Log / 屏幕位 */
+	static void ApplyCategory(uint32& InOutMask, int32 CVarValue, bool bSettingLog, bool bSettingScreen,
+		ENamiCameraLogFlag LogFlag, ENamiCameraLogFlag ScreenFlag)
+	{
+		const bool bLog = CVarValue >= 0 ? (CVarValue & 1) != 0 : bSettingLog;
+		const bool bScreen = CVarValue >= 0 ? (CVarValue & 2) != 0 : bSettingScreen;
+		if (bLog)
+		{
+			InOutMask |= static_cast<uint32>(LogFlag);
+		}
+		if (bScreen)
+		{
+			InOutMask |= static_cast<uint32>(ScreenFlag);
+		}
+	}
+}
+
+void FNamiCameraLogFlags::Refresh()
+{
+	// 控制台变量可能在 UObject 系统就绪前由 ini 设置，此时仅应用覆盖值，模块启动时会再次刷新
+	Refresh(UObjectInitialized() ? GetDefault<UNamiCameraSettings>() : nullptr);
+}
+
+void FNamiCameraLogFlags::Refresh(const UNamiCameraSettings* Settings)
+{
+	using namespace NamiCameraLogFlags_Impl;
+
+	uint32 NewMask = 0;
+	const bool bHasSettings = Settings != nullptr;
+
+	// 堆栈日志只有一个开关，不区分屏幕
+	ApplyCategory(NewMask, GLogStack, bHasSettings && Settings->bEnableStackDebugLog, false,
+		ENamiCameraLogFlag::StackDebug, ENamiCameraLogFlag::None);
+	ApplyCategory(NewMask, GLogEffect, bHasSettings && Settings->bEnableEffectLog, bHasSettings && Settings->bEnableEffectLogOnScreen,
+		ENamiCameraLogFlag::Effect, ENamiCameraLogFlag::EffectOnScreen);
+	ApplyCategory(NewMask, GLogState, bHasSettings && Settings->bEnableStateCalculationLog, bHasSettings && Settings->bEnableStateCalculationLogOnScreen,
+		ENamiCameraLogFlag::StateCalculation, ENamiCameraLogFlag::StateCalculationOnScreen);
+	ApplyCategory(NewMask, GLogComponent, bHasSettings && Settings->bEnableComponentLog, bHasSettings && Settings->bEnableComponentLogOnScreen,
+		ENamiCameraLogFlag::Component, ENamiCameraLogFlag::ComponentOnScreen);
+	ApplyCategory(NewMask, GLogWarning, bHasSettings && Settings->bEnableWarningLog, bHasSettings && Settings->bEnableWarningLogOnScreen,
+		ENamiCameraLogFlag::Warning, ENamiCameraLogFlag::WarningOnScreen);
+	ApplyCategory(NewMask, GLogCameraInfo, bHasSettings && Settings->bEnableCameraInfoLog, bHasSettings && Settings->bEnableCameraInfoLogOnScreen,
+		ENamiCameraLogFlag::CameraInfo, ENamiCameraLogFlag::CameraInfoOnScreen);
+	ApplyCategory(NewMask, GLogModeBlend, bHasSettings && Settings->bEnableModeBlendLog, bHasSettings && Settings->bEnableModeBlendLogOnScreen,
+		ENamiCameraLogFlag::ModeBlend, ENamiCameraLogFlag::ModeBlendOnScreen);
+	ApplyCategory(NewMask, GLogInputInterrupt, bHasSettings && Settings->bEnableInputInterruptLog, bHasSettings && Settings->bEnableInputInterruptLogOnScreen,
+		ENamiCameraLogFlag::InputInterrupt, ENamiCameraLogFlag::InputInterruptOnScreen);
+
+	Mask = NewMask;
+}
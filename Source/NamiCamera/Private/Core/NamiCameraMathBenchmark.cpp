@@ -0,0 +1,653 @@
+// Copyright Qiu, Inc. All Rights Reserved.
+
+#include "Core/NamiCameraMathBenchmark.h"
+
+#include "Core/LogNamiCamera.h"
+#include "Core/NamiCameraBlendKernel.h"
+#include "Core/NamiCameraEasing.h"
+#include "Core/NamiCameraMath.h"
+#include "Core/NamiCameraState.h"
+#include "Core/NamiCameraView.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+namespace NamiCameraMathBenchmark_Impl
+{
+	/** 输入样本数（2 的幂，循环取用） */
+	static constexpr int32 NumInputs = 1024;
+	static constexpr int32 InputMask = NumInputs - 1;
+
+	/** 积分时长（秒） */
+	static constexpr double IntegrationSeconds = 1.0;
+
+	/** 轨迹上相对参考解的允许误差（按初始距离归一化） */
+	static constexpr double TrajectoryTolerance = 0.05;
+
+	/** 1 秒终点在各帧率之间允许的差异（按初始距离归一化） */
+	static constexpr double FrameRateSpreadTolerance = 0.01;
+
+	/** 角度归一化允许误差（度） */
+	static constexpr double AngleTolerance = 1.0e-3;
+
+	/** 混合内核检查的层数 */
+	static constexpr int32 BlendLayerCounts[] = { 2, 3, 4, 6 };
+
+	/** 每个层数检查的随机混合栈数 */
+	static constexpr int32 NumBlendStacks = 10000;
+
+	/** 计时用的混合栈数（2 的幂，循环取用）与层数 */
+	static constexpr int32 NumTimingBlendStacks = 64;
+	static constexpr int32 TimingBlendLayers = 4;
+
+	/**
+	 * 混合内核相对逐层混合的允许误差
+	 * 位置按吊臂长度归一化：逐层混合对未归一化的四元数取 Vector()，吊臂方向本身带有少量误差
+	 * 旋转（度）：四元数插值与欧拉角插值在层间夹角 30 度左右时相差不到 1 度
+	 */
+	static constexpr double BlendLocationTolerance = 0.05;
+	static constexpr double BlendRotationTolerance = 1.0;
+	static constexpr double BlendFOVTolerance = 1.0e-3;
+
+	/** 视图 -> 参数空间状态 -> ComputeOutput 的还原误差（位置按吊臂长度归一化；旋转单位度） */
+	static constexpr double StateRoundTripLocationTolerance = 1.0e-4;
+	static constexpr double StateRoundTripRotationTolerance = 0.01;
+
+	/** 缓动函数与 FMath::InterpEase*（指数 2）的允许误差（float 舍入级别） */
+	static constexpr double EasingTolerance = 1.0e-6;
+
+	/** 缓动函数检查的采样数 */
+	static constexpr int32 NumEasingSamples = 100001;
+
+	/** 防止被测调用被优化掉 */
+	static volatile double GSink = 0.0;
+
+	/** 预生成的输入 */
+	struct FInputs
+	{
+		float Floats[NumInputs];
+		float Angles[NumInputs];
+		FVector Vectors[NumInputs];
+		FRotator Rotators[NumInputs];
+		FQuat Quats[NumInputs];
+
+		FInputs()
+		{
+			FRandomStream Stream(0x4E43);
+			for (int32 Index = 0; Index < NumInputs; ++Index)
+			{
+				Floats[Index] = Stream.FRandRange(-1000.0f, 1000.0f);
+				Angles[Index] = Stream.FRandRange(-720.0f, 720.0f);
+				Vectors[Index] = Stream.VRand() * Stream.FRandRange(1.0f, 1000.0f);
+				Rotators[Index] = FRotator(Stream.FRandRange(-89.0f, 89.0f), Stream.FRandRange(-720.0f, 720.0f), Stream.FRandRange(-180.0f, 180.0f));
+				Quats[Index] = Rotators[Index].Quaternion();
+			}
+		}
+	};
+
+	/**
+	 * 对单个函数计时
+	 * @param Body 以输入索引调用被测函数，返回值累加到 Sink
+	 */
+	template <typename BodyType>
+	static FNamiCameraMathTimingResult Time(const TCHAR* Name, int32 Iterations, int32 Repeats, BodyType&& Body)
+	{
+		const double NsPerCycle = FPlatformTime::GetSecondsPerCycle64() * 1.0e9;
+
+		TArray<double> Samples;
+		Samples.Reserve(Repeats);
+
+		double Sink = 0.0;
+		for (int32 Repeat = 0; Repeat < Repeats; ++Repeat)
+		{
+			const uint64 CyclesBefore = FPlatformTime::Cycles64();
+			for (int32 Index = 0; Index < Iterations; ++Index)
+			{
+				Sink += Body(Index & InputMask);
+			}
+			const uint64 CyclesAfter = FPlatformTime::Cycles64();
+			Samples.Add((CyclesAfter - CyclesBefore) * NsPerCycle / Iterations);
+		}
+		GSink = GSink + Sink;
+
+		Samples.Sort();
+
+		FNamiCameraMathTimingResult Result;
+		Result.Name = Name;
+		Result.Calls = Iterations;
+		Result.MinNsPerCall = Samples[0];
+		Result.MedianNsPerCall = Samples[Samples.Num() / 2];
+		return Result;
+	}
+
+	/** 与帧率无关的参考解：剩余距离比例 exp(-t/SmoothTime) */
+	static double ReferenceRemaining(double Time, double SmoothTime)
+	{
+		return FMath::Exp(-Time / SmoothTime);
+	}
+
+	/**
+	 * 以固定帧率积分 1 秒
+	 * @param Step 推进一帧，返回各分量中相对参考解偏差最大的有符号误差（已按初始距离归一化）
+	 * @param OutMaxError 轨迹上的最大绝对误差
+	 * @param OutFinalError 1 秒终点的有符号误差
+	 */
+	template <typename StepType>
+	static void Integrate(float FrameRate, float SmoothTime, StepType&& Step, double& OutMaxError, double& OutFinalError)
+	{
+		const int32 Steps = FMath::RoundToInt(FrameRate * IntegrationSeconds);
+		const float DeltaTime = 1.0f / FrameRate;
+
+		OutMaxError = 0.0;
+		OutFinalError = 0.0;
+		for (int32 StepIndex = 1; StepIndex <= Steps; ++StepIndex)
+		{
+			const double Reference = ReferenceRemaining(static_cast<double>(StepIndex) / FrameRate, SmoothTime);
+			OutFinalError = Step(DeltaTime, Reference);
+			OutMaxError = FMath::Max(OutMaxError, FMath::Abs(OutFinalError));
+		}
+	}
+
+	/** 取两个有符号误差中绝对值较大的一个 */
+	static double LargerError(double A, double B)
+	{
+		return FMath::Abs(A) >= FMath::Abs(B) ? A : B;
+	}
+
+	/** 平滑函数的单帧推进器工厂：每次调用返回从初始状态开始的新推进器 */
+	using FStepFactory = TFunction<TFunction<double(float, double)>(float SmoothTime)>;
+
+	static TArray<TPair<const TCHAR*, FStepFactory>> MakeSmoothingCases()
+	{
+		TArray<TPair<const TCHAR*, FStepFactory>> Cases;
+
+		Cases.Emplace(TEXT("SmoothDamp(float)"), [](float SmoothTime)
+		{
+			return [SmoothTime, Current = 0.0f, Velocity = 0.0f](float DeltaTime, double Reference) mutable
+			{
+				constexpr float Target = 100.0f;
+				Current = FNamiCameraMath::SmoothDamp(Current, Target, Velocity, SmoothTime, DeltaTime);
+				return (Target - Current) / Target - Reference;
+			};
+		});
+
+		// 跨越 ±180 的最短路径：170 -> -170 应当前进 +20 度
+		Cases.Emplace(TEXT("SmoothDampAngle"), [](float SmoothTime)
+		{
+			return [SmoothTime, Current = 170.0f, Velocity = 0.0f](float DeltaTime, double Reference) mutable
+			{
+				constexpr float Target = -170.0f;
+				Current = FNamiCameraMath::SmoothDampAngle(Current, Target, Velocity, SmoothTime, DeltaTime);
+				return FMath::FindDeltaAngleDegrees(Current, Target) / 20.0 - Reference;
+			};
+		});
+
+		Cases.Emplace(TEXT("SmoothDamp(FVector)"), [](float SmoothTime)
+		{
+			return [SmoothTime, Current = FVector::ZeroVector, Velocity = FVector::ZeroVector](float DeltaTime, double Reference) mutable
+			{
+				const FVector Target(1000.0, -500.0, 250.0);
+				Current = FNamiCameraMath::SmoothDamp(Current, Target, Velocity, SmoothTime, DeltaTime);
+				return FVector::Dist(Current, Target) / Target.Size() - Reference;
+			};
+		});
+
+		// Pitch 10 -> -20，Yaw 350 -> 20（跨越 0 度）
+		Cases.Emplace(TEXT("SmoothDamp(FRotator)"), [](float SmoothTime)
+		{
+			return [SmoothTime, Current = FRotator(10.0, 350.0, 0.0), Velocity = FRotator::ZeroRotator](float DeltaTime, double Reference) mutable
+			{
+				const FRotator Target(-20.0, 20.0, 0.0);
+				Current = FNamiCameraMath::SmoothDamp(Current, Target, Velocity, SmoothTime, DeltaTime);
+				const double PitchError = FMath::FindDeltaAngleDegrees(Current.Pitch, Target.Pitch) / -30.0 - Reference;
+				const double YawError = FMath::FindDeltaAngleDegrees(Current.Yaw, Target.Yaw) / 30.0 - Reference;
+				return LargerError(PitchError, YawError);
+			};
+		});
+
+		Cases.Emplace(TEXT("SmoothDampRotator"), [](float SmoothTime)
+		{
+			return [SmoothTime, Current = FRotator(10.0, 350.0, 0.0), YawVelocity = 0.0f, PitchVelocity = 0.0f](float DeltaTime, double Reference) mutable
+			{
+				const FRotator Target(-20.0, 20.0, 0.0);
+				Current = FNamiCameraMath::SmoothDampRotator(Current, Target, YawVelocity, PitchVelocity, SmoothTime, SmoothTime, DeltaTime);
+				const double PitchError = FMath::FindDeltaAngleDegrees(Current.Pitch, Target.Pitch) / -30.0 - Reference;
+				const double YawError = FMath::FindDeltaAngleDegrees(Current.Yaw, Target.Yaw) / 30.0 - Reference;
+				return LargerError(PitchError, YawError);
+			};
+		});
+
+		Cases.Emplace(TEXT("SmoothDamp(FQuat)"), [](float SmoothTime)
+		{
+			return [SmoothTime, Current = FQuat::Identity, AngularVelocity = 0.0f](float DeltaTime, double Reference) mutable
+			{
+				const FQuat Target = FRotator(30.0, 90.0, 0.0).Quaternion();
+				const double InitialAngle = FQuat::Identity.AngularDistance(Target);
+				Current = FNamiCameraMath::SmoothDamp(Current, Target, AngularVelocity, SmoothTime, DeltaTime);
+				return Current.AngularDistance(Target) / InitialAngle - Reference;
+			};
+		});
+
+		return Cases;
+	}
+
+	/** 双精度参考：归一化到 [0, 360) */
+	static double ReferenceNormalize360(double AngleDeg)
+	{
+		const double Result = FMath::Fmod(AngleDeg, 360.0);
+		return Result < 0.0 ? Result + 360.0 : Result;
+	}
+
+	/** 考虑 0/360 环绕的角度误差 */
+	static double WrappedAngleError(double A, double B)
+	{
+		const double Diff = FMath::Abs(ReferenceNormalize360(A) - ReferenceNormalize360(B));
+		return FMath::Min(Diff, 360.0 - Diff);
+	}
+
+	/** 随机混合栈：各层围绕同一目标，层间夹角控制在常见的模式切换范围内（ViewPtrs 指向自身的 Views，不可复制） */
+	struct FBlendStack
+	{
+		TArray<FNamiCameraView> Views;
+		TArray<const FNamiCameraView*> ViewPtrs;
+		TArray<FNamiCameraState> States;
+		TArray<const FNamiCameraState*> StatePtrs;
+		TArray<float> Contributions;
+
+		FBlendStack(const FBlendStack&) = delete;
+		FBlendStack& operator=(const FBlendStack&) = delete;
+
+		FBlendStack(FRandomStream& Stream, int32 NumLayers)
+		{
+			const FVector Target(Stream.FRandRange(-10000.0f, 10000.0f), Stream.FRandRange(-10000.0f, 10000.0f), Stream.FRandRange(0.0f, 2000.0f));
+			const FRotator BaseRotation(Stream.FRandRange(-30.0f, 0.0f), Stream.FRandRange(-180.0f, 180.0f), 0.0f);
+
+			Views.SetNum(NumLayers);
+			for (FNamiCameraView& View : Views)
+			{
+				const FRotator ArmRotation = BaseRotation + FRotator(Stream.FRandRange(-10.0f, 10.0f), Stream.FRandRange(-15.0f, 15.0f), 0.0f);
+				View.PivotLocation = Target + Stream.VRand() * Stream.FRandRange(0.0f, 50.0f);
+				View.CameraLocation = View.PivotLocation - ArmRotation.Vector() * Stream.FRandRange(200.0f, 600.0f);
+				View.CameraRotation = ArmRotation + FRotator(Stream.FRandRange(-5.0f, 5.0f), Stream.FRandRange(-5.0f, 5.0f), 0.0f);
+				View.ControlLocation = View.PivotLocation;
+				View.ControlRotation = BaseRotation + FRotator(0.0f, Stream.FRandRange(-15.0f, 15.0f), 0.0f);
+				View.FOV = Stream.FRandRange(60.0f, 100.0f);
+			}
+			States.SetNum(NumLayers);
+			for (int32 Index = 0; Index < NumLayers; ++Index)
+			{
+				States[Index].SetFromView(Views[Index]);
+				ViewPtrs.Add(&Views[Index]);
+				StatePtrs.Add(&States[Index]);
+			}
+
+			// 与 FNamiCameraModeStack::ComputeContributions 相同：从栈底向栈顶累乘 (1 - BlendWeight)
+			Contributions.SetNumUninitialized(NumLayers);
+			float AccumulatedWeight = 1.0f;
+			for (int32 Index = NumLayers - 1; Index >= 0; --Index)
+			{
+				const float BlendWeight = Stream.FRand();
+				Contributions[Index] = BlendWeight * AccumulatedWeight;
+				AccumulatedWeight *= (1.0f - BlendWeight);
+			}
+		}
+	};
+
+	/** 两个旋转之间的夹角（度） */
+	static double RotationError(const FRotator& A, const FRotator& B)
+	{
+		return FMath::RadiansToDegrees(A.Quaternion().AngularDistance(B.Quaternion()));
+	}
+
+	static FNamiCameraMathAccuracyResult MakeCheck(const TCHAR* Name, float FrameRate, double MaxError, double Tolerance)
+	{
+		FNamiCameraMathAccuracyResult Result;
+		Result.Name = Name;
+		Result.FrameRate = FrameRate;
+		Result.MaxError = MaxError;
+		Result.Tolerance = Tolerance;
+		Result.bPassed = MaxError <= Tolerance;
+		return Result;
+	}
+}
+
+FString FNamiCameraMathTimingResult::ToJson() const
+{
+	return FString::Printf(TEXT("{\"name\":\"%s\",\"calls\":%d,\"min_ns_per_call\":%.3f,\"median_ns_per_call\":%.3f}"),
+		*Name, Calls, MinNsPerCall, MedianNsPerCall);
+}
+
+FString FNamiCameraMathAccuracyResult::ToJson() const
+{
+	return FString::Printf(TEXT("{\"name\":\"%s\",\"frame_rate\":%.0f,\"max_error\":%.6g,\"tolerance\":%.6g,\"passed\":%s}"),
+		*Name, FrameRate, MaxError, Tolerance, bPassed ? TEXT("true") : TEXT("false"));
+}
+
+void FNamiCameraMathBenchmark::RunTimings(int32 Iterations, int32 Repeats, TArray<FNamiCameraMathTimingResult>& OutResults)
+{
+	using namespace NamiCameraMathBenchmark_Impl;
+
+	Iterations = FMath::Max(Iterations, 1);
+	Repeats = FMath::Max(Repeats, 1);
+
+	// 输入约 100KB，放在堆上
+	const TUniquePtr<FInputs> InputsPtr = MakeUnique<FInputs>();
+	const FInputs& In = *InputsPtr;
+	constexpr float SmoothTime = 0.25f;
+	constexpr float DeltaTime = 1.0f / 60.0f;
+
+	OutResults.Add(Time(TEXT("SmoothDamp(float)"), Iterations, Repeats, [&In](int32 Index)
+	{
+		float Velocity = 0.0f;
+		return FNamiCameraMath::SmoothDamp(In.Floats[Index], In.Floats[(Index + 1) & InputMask], Velocity, SmoothTime, DeltaTime);
+	}));
+
+	OutResults.Add(Time(TEXT("SmoothDampAngle"), Iterations, Repeats, [&In](int32 Index)
+	{
+		float Velocity = 0.0f;
+		return FNamiCameraMath::SmoothDampAngle(In.Angles[Index], In.Angles[(Index + 1) & InputMask], Velocity, SmoothTime, DeltaTime);
+	}));
+
+	OutResults.Add(Time(TEXT("SmoothDamp(FVector)"), Iterations, Repeats, [&In](int32 Index)
+	{
+		FVector Velocity = FVector::ZeroVector;
+		return FNamiCameraMath::SmoothDamp(In.Vectors[Index], In.Vectors[(Index + 1) & InputMask], Velocity, SmoothTime, DeltaTime).X;
+	}));
+
+	OutResults.Add(Time(TEXT("SmoothDamp(FRotator)"), Iterations, Repeats, [&In](int32 Index)
+	{
+		FRotator Velocity = FRotator::ZeroRotator;
+		return FNamiCameraMath::SmoothDamp(In.Rotators[Index], In.Rotators[(Index + 1) & InputMask], Velocity, SmoothTime, DeltaTime).Yaw;
+	}));
+
+	OutResults.Add(Time(TEXT("SmoothDampRotator"), Iterations, Repeats, [&In](int32 Index)
+	{
+		float YawVelocity = 0.0f;
+		float PitchVelocity = 0.0f;
+		return FNamiCameraMath::SmoothDampRotator(In.Rotators[Index], In.Rotators[(Index + 1) & InputMask],
+			YawVelocity, PitchVelocity, SmoothTime, SmoothTime, DeltaTime).Yaw;
+	}));
+
+	OutResults.Add(Time(TEXT("SmoothDamp(FQuat)"), Iterations, Repeats, [&In](int32 Index)
+	{
+		float AngularVelocity = 0.0f;
+		return FNamiCameraMath::SmoothDamp(In.Quats[Index], In.Quats[(Index + 1) & InputMask], AngularVelocity, SmoothTime, DeltaTime).W;
+	}));
+
+	OutResults.Add(Time(TEXT("NormalizeRotatorTo360"), Iterations, Repeats, [&In](int32 Index)
+	{
+		return FNamiCameraMath::NormalizeRotatorTo360(In.Rotators[Index]).Yaw;
+	}));
+
+	OutResults.Add(Time(TEXT("FindDeltaAngle360"), Iterations, Repeats, [&In](int32 Index)
+	{
+		return FNamiCameraMath::FindDeltaAngle360(In.Angles[Index], In.Angles[(Index + 1) & InputMask]);
+	}));
+
+	OutResults.Add(Time(TEXT("FMath::InterpEaseInOut"), Iterations, Repeats, [&In](int32 Index)
+	{
+		return FMath::InterpEaseInOut(0.0f, 1.0f, In.Floats[Index] * 0.0005f + 0.5f, 2.0f);
+	}));
+
+	OutResults.Add(Time(TEXT("FNamiCameraEasing::EaseInOut"), Iterations, Repeats, [&In](int32 Index)
+	{
+		return FNamiCameraEasing::EaseInOut(In.Floats[Index] * 0.0005f + 0.5f);
+	}));
+
+	// 混合内核：每次调用混合一个 4 层的栈
+	FRandomStream BlendStream(0x4E43);
+	TArray<FBlendStack> BlendStacks;
+	BlendStacks.Reserve(NumTimingBlendStacks);
+	for (int32 Index = 0; Index < NumTimingBlendStacks; ++Index)
+	{
+		BlendStacks.Emplace(BlendStream, TimingBlendLayers);
+	}
+	const int32 BlendIterations = FMath::Max(Iterations / 10, 1);
+
+	OutResults.Add(Time(TEXT("BlendSequential(4 layers)"), BlendIterations, Repeats, [&BlendStacks](int32 Index)
+	{
+		const FBlendStack& Stack = BlendStacks[Index & (NumTimingBlendStacks - 1)];
+		FNamiCameraView View;
+		FNamiCameraBlendKernel::BlendSequential(Stack.ViewPtrs, Stack.Contributions, View);
+		return View.CameraLocation.X;
+	}));
+
+	OutResults.Add(Time(TEXT("BlendKernel(4 layers)"), BlendIterations, Repeats, [&BlendStacks](int32 Index)
+	{
+		const FBlendStack& Stack = BlendStacks[Index & (NumTimingBlendStacks - 1)];
+		FNamiCameraView View;
+		FNamiCameraBlendKernel::Blend(Stack.ViewPtrs, Stack.Contributions, View);
+		return View.CameraLocation.X;
+	}));
+
+	OutResults.Add(Time(TEXT("BlendStates(4 layers)"), BlendIterations, Repeats, [&BlendStacks](int32 Index)
+	{
+		const FBlendStack& Stack = BlendStacks[Index & (NumTimingBlendStacks - 1)];
+		FNamiCameraState State;
+		FNamiCameraView View;
+		FNamiCameraBlendKernel::BlendStates(Stack.StatePtrs, Stack.ViewPtrs, Stack.Contributions, State, View);
+		return View.CameraLocation.X;
+	}));
+}
+
+bool FNamiCameraMathBenchmark::RunAccuracyChecks(float SmoothTime, TArray<FNamiCameraMathAccuracyResult>& OutResults)
+{
+	using namespace NamiCameraMathBenchmark_Impl;
+
+	SmoothTime = FMath::Max(SmoothTime, KINDA_SMALL_NUMBER);
+	bool bAllPassed = true;
+
+	// 平滑函数：各帧率下的轨迹误差，以及 1 秒终点在帧率之间的差异
+	for (const TPair<const TCHAR*, FStepFactory>& Case : MakeSmoothingCases())
+	{
+		double MinFinalError = TNumericLimits<double>::Max();
+		double MaxFinalError = TNumericLimits<double>::Lowest();
+
+		for (const float FrameRate : FrameRates)
+		{
+			double MaxError = 0.0;
+			double FinalError = 0.0;
+			Integrate(FrameRate, SmoothTime, Case.Value(SmoothTime), MaxError, FinalError);
+
+			MinFinalError = FMath::Min(MinFinalError, FinalError);
+			MaxFinalError = FMath::Max(MaxFinalError, FinalError);
+
+			const FString Name = FString::Printf(TEXT("%s.Trajectory"), Case.Key);
+			OutResults.Add(MakeCheck(*Name, FrameRate, MaxError, TrajectoryTolerance));
+			bAllPassed &= OutResults.Last().bPassed;
+		}
+
+		const FString Name = FString::Printf(TEXT("%s.FrameRateSpread"), Case.Key);
+		OutResults.Add(MakeCheck(*Name, 0.0f, MaxFinalError - MinFinalError, FrameRateSpreadTolerance));
+		bAllPassed &= OutResults.Last().bPassed;
+	}
+
+	// 角度函数：与双精度 fmod 结果比较，并检查输出范围
+	FRandomStream Stream(0x4E43);
+	double NormalizeError = 0.0;
+	double DeltaError = 0.0;
+	for (int32 Index = 0; Index < 100000; ++Index)
+	{
+		const FRotator Rot(Stream.FRandRange(-10000.0f, 10000.0f), Stream.FRandRange(-10000.0f, 10000.0f), Stream.FRandRange(-10000.0f, 10000.0f));
+		const FRotator Normalized = FNamiCameraMath::NormalizeRotatorTo360(Rot);
+		for (const double Component : { Normalized.Pitch, Normalized.Yaw, Normalized.Roll })
+		{
+			if (Component < 0.0 || Component > 360.0)
+			{
+				NormalizeError = TNumericLimits<double>::Max();
+			}
+		}
+		NormalizeError = FMath::Max(NormalizeError, WrappedAngleError(Normalized.Pitch, static_cast<float>(Rot.Pitch)));
+		NormalizeError = FMath::Max(NormalizeError, WrappedAngleError(Normalized.Yaw, static_cast<float>(Rot.Yaw)));
+		NormalizeError = FMath::Max(NormalizeError, WrappedAngleError(Normalized.Roll, static_cast<float>(Rot.Roll)));
+
+		const float CurrentDeg = static_cast<float>(Rot.Pitch);
+		const float TargetDeg = static_cast<float>(Rot.Yaw);
+		const double Delta = FNamiCameraMath::FindDeltaAngle360(CurrentDeg, TargetDeg);
+		double ReferenceDelta = ReferenceNormalize360(static_cast<double>(TargetDeg) - static_cast<double>(CurrentDeg));
+		if (ReferenceDelta > 180.0)
+		{
+			ReferenceDelta -= 360.0;
+		}
+		if (Delta < -180.0 || Delta > 180.0)
+		{
+			DeltaError = TNumericLimits<double>::Max();
+		}
+		// ±180 两种结果都是最短路径
+		DeltaError = FMath::Max(DeltaError, WrappedAngleError(Delta, ReferenceDelta));
+	}
+
+	OutResults.Add(MakeCheck(TEXT("NormalizeRotatorTo360"), 0.0f, NormalizeError, AngleTolerance));
+	bAllPassed &= OutResults.Last().bPassed;
+	OutResults.Add(MakeCheck(TEXT("FindDeltaAngle360"), 0.0f, DeltaError, AngleTolerance));
+	bAllPassed &= OutResults.Last().bPassed;
+
+	// 缓动函数：在 [0, 1] 上与 FMath 参考实现逐点比较
+	double EaseInError = 0.0;
+	double EaseOutError = 0.0;
+	double EaseInOutError = 0.0;
+	for (int32 Index = 0; Index < NumEasingSamples; ++Index)
+	{
+		const float Alpha = static_cast<float>(Index) / (NumEasingSamples - 1);
+		EaseInError = FMath::Max(EaseInError, static_cast<double>(FMath::Abs(FNamiCameraEasing::EaseIn(Alpha) - FMath::InterpEaseIn(0.0f, 1.0f, Alpha, 2.0f))));
+		EaseOutError = FMath::Max(EaseOutError, static_cast<double>(FMath::Abs(FNamiCameraEasing::EaseOut(Alpha) - FMath::InterpEaseOut(0.0f, 1.0f, Alpha, 2.0f))));
+		EaseInOutError = FMath::Max(EaseInOutError, static_cast<double>(FMath::Abs(FNamiCameraEasing::EaseInOut(Alpha) - FMath::InterpEaseInOut(0.0f, 1.0f, Alpha, 2.0f))));
+	}
+
+	OutResults.Add(MakeCheck(TEXT("Easing.EaseIn"), 0.0f, EaseInError, EasingTolerance));
+	bAllPassed &= OutResults.Last().bPassed;
+	OutResults.Add(MakeCheck(TEXT("Easing.EaseOut"), 0.0f, EaseOutError, EasingTolerance));
+	bAllPassed &= OutResults.Last().bPassed;
+	OutResults.Add(MakeCheck(TEXT("Easing.EaseInOut"), 0.0f, EaseInOutError, EasingTolerance));
+	bAllPassed &= OutResults.Last().bPassed;
+
+	// 混合内核：与逐层混合的参考结果比较
+	for (const int32 NumLayers : BlendLayerCounts)
+	{
+		double LocationError = 0.0;
+		double RotationErrorDeg = 0.0;
+		double FOVError = 0.0;
+		for (int32 Index = 0; Index < NumBlendStacks; ++Index)
+		{
+			const FBlendStack Stack(Stream, NumLayers);
+			FNamiCameraView Reference;
+			FNamiCameraView Result;
+			FNamiCameraBlendKernel::BlendSequential(Stack.ViewPtrs, Stack.Contributions, Reference);
+			FNamiCameraBlendKernel::Blend(Stack.ViewPtrs, Stack.Contributions, Result);
+
+			const double ArmLength = FMath::Max(FVector::Dist(Reference.CameraLocation, Reference.PivotLocation), 1.0);
+			LocationError = FMath::Max(LocationError, FVector::Dist(Result.PivotLocation, Reference.PivotLocation) / ArmLength);
+			LocationError = FMath::Max(LocationError, FVector::Dist(Result.CameraLocation, Reference.CameraLocation) / ArmLength);
+			LocationError = FMath::Max(LocationError, FVector::Dist(Result.ControlLocation, Reference.ControlLocation) / ArmLength);
+			RotationErrorDeg = FMath::Max(RotationErrorDeg, RotationError(Result.CameraRotation, Reference.CameraRotation));
+			RotationErrorDeg = FMath::Max(RotationErrorDeg, RotationError(Result.ControlRotation, Reference.ControlRotation));
+			FOVError = FMath::Max(FOVError, static_cast<double>(FMath::Abs(Result.FOV - Reference.FOV)));
+		}
+
+		OutResults.Add(MakeCheck(*FString::Printf(TEXT("BlendKernel.Location(%d layers)"), NumLayers), 0.0f, LocationError, BlendLocationTolerance));
+		bAllPassed &= OutResults.Last().bPassed;
+		OutResults.Add(MakeCheck(*FString::Printf(TEXT("BlendKernel.Rotation(%d layers)"), NumLayers), 0.0f, RotationErrorDeg, BlendRotationTolerance));
+		bAllPassed &= OutResults.Last().bPassed;
+		OutResults.Add(MakeCheck(*FString::Printf(TEXT("BlendKernel.FOV(%d layers)"), NumLayers), 0.0f, FOVError, BlendFOVTolerance));
+		bAllPassed &= OutResults.Last().bPassed;
+	}
+
+	// 参数空间状态：由视图反推的状态经 ComputeOutput 应还原该视图
+	double StateLocationError = 0.0;
+	double StateRotationErrorDeg = 0.0;
+	for (int32 Index = 0; Index < NumBlendStacks; ++Index)
+	{
+		const FBlendStack Stack(Stream, 1);
+		const FNamiCameraView& View = Stack.Views[0];
+		FNamiCameraState State = Stack.States[0];
+		State.ComputeOutput();
+
+		const double ArmLength = FMath::Max(FVector::Dist(View.CameraLocation, View.PivotLocation), 1.0);
+		StateLocationError = FMath::Max(StateLocationError, FVector::Dist(State.CameraLocation, View.CameraLocation) / ArmLength);
+		StateRotationErrorDeg = FMath::Max(StateRotationErrorDeg, RotationError(State.CameraRotation, View.CameraRotation));
+	}
+
+	OutResults.Add(MakeCheck(TEXT("CameraState.RoundTrip.Location"), 0.0f, StateLocationError, StateRoundTripLocationTolerance));
+	bAllPassed &= OutResults.Last().bPassed;
+	OutResults.Add(MakeCheck(TEXT("CameraState.RoundTrip.Rotation"), 0.0f, StateRotationErrorDeg, StateRoundTripRotationTolerance));
+	bAllPassed &= OutResults.Last().bPassed;
+
+	return bAllPassed;
+}
+
+FString FNamiCameraMathBenchmark::ResultsToJson(const TArray<FNamiCameraMathTimingResult>& Timings, const TArray<FNamiCameraMathAccuracyResult>& Checks)
+{
+	FString Json = TEXT("{\"timings\":[");
+	for (int32 Index = 0; Index < Timings.Num(); ++Index)
+	{
+		if (Index > 0)
+		{
+			Json += TEXT(",");
+		}
+		Json += Timings[Index].ToJson();
+	}
+	Json += TEXT("],\"accuracy\":[");
+	for (int32 Index = 0; Index < Checks.Num(); ++Index)
+	{
+		if (Index > 0)
+		{
+			Json += TEXT(",");
+		}
+		Json += Checks[Index].ToJson();
+	}
+	Json += TEXT("]}");
+	return Json;
+}
+
+// ========== 控制台命令 ==========
+
+static FAutoConsoleCommand GNamiCameraMathBenchmarkCommand(
+	TEXT("NamiCamera.MathBenchmark"),
+	TEXT("运行 FNamiCameraMath 微基准与精度检查并输出 JSON。参数：Iterations=N Repeats=N SmoothTime=秒 Out=路径"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const FString CmdLine = FString::Join(Args, TEXT(" "));
+
+		int32 Iterations = 1000000;
+		int32 Repeats = 5;
+		float SmoothTime = 0.25f;
+		FString OutPath = FPaths::ProjectSavedDir() / TEXT("NamiCamera") / TEXT("MathBenchmark.json");
+		FParse::Value(*CmdLine, TEXT("Iterations="), Iterations);
+		FParse::Value(*CmdLine, TEXT("Repeats="), Repeats);
+		FParse::Value(*CmdLine, TEXT("SmoothTime="), SmoothTime);
+		FParse::Value(*CmdLine, TEXT("Out="), OutPath);
+
+		TArray<FNamiCameraMathTimingResult> Timings;
+		FNamiCameraMathBenchmark::RunTimings(Iterations, Repeats, Timings);
+		for (const FNamiCameraMathTimingResult& Timing : Timings)
+		{
+			UE_LOG(LogNamiCamera, Display, TEXT("[NamiCamera.MathBenchmark] %s"), *Timing.ToJson());
+		}
+
+		TArray<FNamiCameraMathAccuracyResult> Checks;
+		const bool bAllPassed = FNamiCameraMathBenchmark::RunAccuracyChecks(SmoothTime, Checks);
+		for (const FNamiCameraMathAccuracyResult& Check : Checks)
+		{
+			if (Check.bPassed)
+			{
+				UE_LOG(LogNamiCamera, Display, TEXT("[NamiCamera.MathBenchmark] %s"), *Check.ToJson());
+			}
+			else
+			{
+				UE_LOG(LogNamiCamera, Warning, TEXT("[NamiCamera.MathBenchmark] FAILED %s"), *Check.ToJson());
+			}
+		}
+
+		const FString Json = FNamiCameraMathBenchmark::ResultsToJson(Timings, Checks);
+		if (FFileHelper::SaveStringToFile(Json, *OutPath))
+		{
+			UE_LOG(LogNamiCamera, Display, TEXT("[NamiCamera.MathBenchmark] Wrote %d timings and %d checks (%s) to %s"),
+				Timings.Num(), Checks.Num(), bAllPassed ? TEXT("all passed") : TEXT("some failed"), *OutPath);
+		}
+		else
+		{
+			UE_LOG(LogNamiCamera, Error, TEXT("[NamiCamera.MathBenchmark] Failed to write %s"), *OutPath);
+		}
+	}));
@@ -0,0 +1,123 @@
+// Copyright Qiu, Inc. All Rights Reserved.
+
+#include "Core/NamiCameraModePriorityStack.h"
+
+#include "CameraModes/NamiCameraModeBase.h"
+
+int32 FNamiCameraModePriorityStack::Push(UNamiCameraModeBase* CameraMode, int32 Priority, int32& OutSlotIndex)
+{
+	const int32 HandleId = NextHandleId.fetch_add(1, std::memory_order_relaxed);
+
+	// 分配槽位（优先复用空闲槽位）
+	if (FirstFreeSlot != INDEX_NONE)
+	{
+		OutSlotIndex = FirstFreeSlot;
+		FirstFreeSlot = Slots[OutSlotIndex].NextFree;
+	}
+	else
+	{
+		OutSlotIndex = Slots.AddDefaulted();
+	}
+	FSlot& Slot = Slots[OutSlotIndex];
+	Slot.HandleId = HandleId;
+	Slot.Priority = Priority;
+	Slot.NextFree = INDEX_NONE;
+
+	// 插入到第一个优先级更高的条目之前；最常见的情况（不低于栈顶）直接追加
+	int32 InsertIndex = Entries.Num();
+	if (Entries.Num() > 0 && Entries.Last().Priority > Priority)
+	{
+		int32 Low = 0;
+		int32 High = Entries.Num();
+		while (Low < High)
+		{
+			const int32 Mid = (Low + High) / 2;
+			if (Entries[Mid].Priority > Priority)
+			{
+				High = Mid;
+			}
+			else
+			{
+				Low = Mid + 1;
+			}
+		}
+		InsertIndex = Low;
+	}
+
+	FNamiCameraModeStackEntry Entry;
+	Entry.HandleId = HandleId;
+	Entry.SlotIndex = OutSlotIndex;
+	Entry.Priority = Priority;
+	Entry.CameraMode = CameraMode;
+	Entries.Insert(Entry, InsertIndex);
+
+	return HandleId;
+}
+
+int32 FNamiCameraModePriorityStack::IndexOfHandle(int32 SlotIndex, int32 HandleId) const
+{
+	if (HandleId == 0 || !Slots.IsValidIndex(SlotIndex) || Slots[SlotIndex].HandleId != HandleId)
+	{
+		return INDEX_NONE;
+	}
+	return FindEntryIndex(Slots[SlotIndex].Priority, HandleId);
+}
+
+int32 FNamiCameraModePriorityStack::IndexOfMode(const UNamiCameraModeBase* CameraMode) const
+{
+	// 与原 PopCameraModeInstance 一致：同一实例多次入栈时返回数组中第一个条目
+	return Entries.IndexOfByPredicate([CameraMode](const FNamiCameraModeStackEntry& Entry)
+	{
+		return Entry.CameraMode.Get() == CameraMode;
+	});
+}
+
+void FNamiCameraModePriorityStack::RemoveAt(int32 Index)
+{
+	if (!Entries.IsValidIndex(Index))
+	{
+		return;
+	}
+
+	// 释放槽位，HandleId 清零后旧句柄失效
+	FSlot& Slot = Slots[Entries[Index].SlotIndex];
+	Slot.HandleId = 0;
+	Slot.NextFree = FirstFreeSlot;
+	FirstFreeSlot = Entries[Index].SlotIndex;
+
+	Entries.RemoveAt(Index);
+}
+
+void FNamiCameraModePriorityStack::Empty()
+{
+	Entries.Reset();
+	Slots.Reset();
+	FirstFreeSlot = INDEX_NONE;
+}
+
+int32 FNamiCameraModePriorityStack::FindEntryIndex(int32 Priority, int32 HandleId) const
+{
+	// 栈顶快速路径
+	if (Entries.Num() > 0 && Entries.Last().HandleId == HandleId)
+	{
+		return Entries.Num() - 1;
+	}
+
+	// 视图按 (Priority, HandleId) 升序
+	int32 Low = 0;
+	int32 High = Entries.Num();
+	while (Low < High)
+	{
+		const int32 Mid = (Low + High) / 2;
+		const FNamiCameraModeStackEntry& Entry = Entries[Mid];
+		if (Entry.Priority < Priority || (Entry.Priority == Priority && Entry.HandleId < HandleId))
+		{
+			Low = Mid + 1;
+		}
+		else
+		{
+			High = Mid;
+		}
+	}
+	return Entries.IsValidIndex(Low) && Entries[Low].HandleId == HandleId ? Low : INDEX_NONE;
+}
@@ -7,6 +7,40 @@
 #include "Engine/Engine.h"
 #include "CameraModes/NamiCameraModeBase.h"
 #include "Core/NamiCameraView.h"
+#include "Core/NamiCameraBlendKernel.h"
+#include "Core/NamiCameraStats.h"
+#include "HAL/IConsoleManager.h"
+
+namespace NamiCameraModeStack_Impl
+{
+	static float GMinContributionOverride = -1.0f;
+	static FAutoConsoleVariableRef CVarMinContribution(
+		TEXT("NamiCamera.ModeStack.MinContribution"),
+		GMinContributionOverride,
+		TEXT("非栈顶模式完整评估所需的最小有效贡献。-1=跟随组件设置，0=始终完整评估"),
+		ECVF_Default);
+
+	static bool GSequentialBlend = false;
+	static FAutoConsoleVariableRef CVarSequentialBlend(
+		TEXT("NamiCamera.ModeStack.SequentialBlend"),
+		GSequentialBlend,
+		TEXT("使用逐层 FNamiCameraView::Blend 的旧混合路径（对比/回退用）。0=向量化一次遍历混合，1=逐层混合"),
+		ECVF_Default);
+
+	static int32 GMaxDepthOverride = -1;
+	static FAutoConsoleVariableRef CVarMaxDepth(
+		TEXT("NamiCamera.ModeStack.MaxDepth"),
+		GMaxDepthOverride,
+		TEXT("同时评估的模式数上限，超出的最老模式合并为冻结快照。-1=跟随组件设置，0=不限制"),
+		ECVF_Default);
+
+	static bool GParameterSpaceBlend = true;
+	static FAutoConsoleVariableRef CVarParameterSpaceBlend(
+		TEXT("NamiCamera.ModeStack.ParameterSpaceBlend"),
+		GParameterSpaceBlend,
+		TEXT("参与混合的模式都提供参数空间状态时按参数混合。0=始终按视图混合，1=按模式设置"),
+		ECVF_Default);
+}
 
 void FNamiCameraModeStack::PushCameraMode(UNamiCameraModeBase* CameraModeInstance)
 {
@@ -52,8 +86,13 @@ void FNamiCameraModeStack::PushCameraMode(UNamiCameraModeBase* CameraModeInstanc
 		ExistingStackContribution = 0.0f;
 	}
 
-	// 计算起始权重
-	const bool bShouldBlend = ((CameraModeInstance->GetBlendAlpha().BlendTime >= 0.0f) && (StackSize > 0));
+	// 惯性化过渡：需要有可作为源的输出视图
+	const FNamiBlendConfig& BlendConfig = CameraModeInstance->BlendConfig;
+	const bool bInertialize = BlendConfig.TransitionType == ENamiCameraTransitionType::Inertialization
+		&& BlendConfig.BlendTime > 0.0f && StackSize > 0 && NumOutputHistory > 0;
+
+	// 计算起始权重（惯性化时直接满权重）
+	const bool bShouldBlend = !bInertialize && ((CameraModeInstance->GetBlendAlpha().BlendTime >= 0.0f) && (StackSize > 0));
 	const float StartBlendWeight = (bShouldBlend ? ExistingStackContribution : 1.0f);
 
 	NAMI_LOG_MODE_BLEND(Log,
@@ -70,8 +109,23 @@ void FNamiCameraModeStack::PushCameraMode(UNamiCameraModeBase* CameraModeInstanc
 	// 将新条目添加到堆栈
 	CameraModeStack.Insert(CameraModeInstance, 0);
 
+	if (bInertialize)
+	{
+		// 旧模式不再评估，切换偏移由 Inertializer 在新模式之上衰减
+		for (int32 StackIndex = CameraModeStack.Num() - 1; StackIndex > 0; --StackIndex)
+		{
+			CameraModeStack[StackIndex]->Deactivate();
+			CameraModeStack.RemoveAt(StackIndex);
+		}
+		ClearCollapsedSnapshot();
+		bPendingInertialization = true;
+		PendingInertializationTime = BlendConfig.BlendTime;
+
+		NAMI_LOG_MODE_BLEND(Log, TEXT("[PushCameraMode] Mode=%s, inertialization over %.3fs"),
+			*CameraModeInstance->GetName(), PendingInertializationTime);
+	}
 	// 让栈底（旧模式）准备淡出
-	if (CameraModeStack.Num() > 1)
+	else if (CameraModeStack.Num() > 1)
 	{
 		UNamiCameraModeBase* OldMode = CameraModeStack.Last();
 		// 从当前权重平滑过渡到 0（淡出）
@@ -94,15 +148,29 @@ void FNamiCameraModeStack::PushCameraMode(UNamiCameraModeBase* CameraModeInstanc
 	}
 }
 
-bool FNamiCameraModeStack::EvaluateStack(float DeltaTime, FNamiCameraView& OutCameraModeView)
+bool FNamiCameraModeStack::EvaluateStack(float DeltaTime, FNamiCameraView& OutCameraModeView, bool bTopModeOnly)
 {
-	if (!UpdateStack(DeltaTime))
+	if (!UpdateStack(DeltaTime, bTopModeOnly))
 	{
 		return false;
 	}
 
 	BlendStack(OutCameraModeView, DeltaTime);
 
+	// 惯性化过渡：以上一帧输出为源、本帧新模式视图为目标捕获偏移与速度
+	if (bPendingInertialization)
+	{
+		bPendingInertialization = false;
+		Inertializer.Begin(NumOutputHistory > 1 ? PrevOutputView : LastOutputView, LastOutputView, LastOutputDeltaTime,
+			OutCameraModeView, PendingInertializationTime);
+	}
+	Inertializer.Apply(DeltaTime, OutCameraModeView);
+
+	PrevOutputView = LastOutputView;
+	LastOutputView = OutCameraModeView;
+	LastOutputDeltaTime = DeltaTime;
+	NumOutputHistory = FMath::Min(NumOutputHistory + 1, 2);
+
 	return true;
 }
 
@@ -156,10 +224,28 @@ void FNamiCameraModeStack::DumpCameraModeStack(const bool bPrintToScreen, const
 			NAMI_LOG_STACK(Log, TEXT("%s"), *Message);
 		}
 	}
+
+	if (bHasCollapsedSnapshot)
+	{
+		const FString Message = FString::Printf(TEXT("[Stack %d] <Collapsed Snapshot> | Weight: %.3f | Frozen"),
+			CameraModeStack.Num(), CollapsedWeight);
+		if (bPrintToScreen && GEngine)
+		{
+			GEngine->AddOnScreenDebugMessage(-1 - CameraModeStack.Num(), Duration, TextColor.ToFColor(true), Message);
+		}
+		if (bPrintToLog)
+		{
+			NAMI_LOG_STACK(Log, TEXT("%s"), *Message);
+		}
+	}
 }
 
-bool FNamiCameraModeStack::UpdateStack(float DeltaTime)
+bool FNamiCameraModeStack::UpdateStack(float DeltaTime, bool bTopModeOnly)
 {
+	// 超出深度上限的模式先合并，之后的评估开销与推送次数无关
+	EnforceMaxDepth();
+	UpdateCollapsedSnapshot(DeltaTime);
+
 	const int32 StackSize = CameraModeStack.Num();
 	if (StackSize <= 0)
 	{
@@ -168,6 +254,13 @@ bool FNamiCameraModeStack::UpdateStack(float DeltaTime)
 
 	bool bHasValidCameraMode = false;
 
+	// 先按上一帧的权重计算有效贡献：被上层模式压到接近 0 的模式不必完整评估
+	const float EffectiveMinContribution = NamiCameraModeStack_Impl::GMinContributionOverride >= 0.0f
+		? NamiCameraModeStack_Impl::GMinContributionOverride
+		: MinContribution;
+	TArray<float, TInlineAllocator<8>> Contributions;
+	ComputeContributions(Contributions);
+
 	// 从后往前遍历，这样删除元素时不会影响索引
 	for (int32 StackIndex = StackSize - 1; StackIndex >= 0; --StackIndex)
 	{
@@ -177,7 +270,22 @@ bool FNamiCameraModeStack::UpdateStack(float DeltaTime)
 		if (CameraMode->bIsActivated)
 		{
 			bHasValidCameraMode = true;
-			CameraMode->Tick(DeltaTime);
+
+			// 栈顶始终完整评估；其余模式在帧预算降级或贡献过低时跳过
+			const bool bSkipEvaluation = StackIndex > 0
+				&& (bTopModeOnly || (EffectiveMinContribution > 0.0f && Contributions[StackIndex] < EffectiveMinContribution));
+			if (bSkipEvaluation)
+			{
+				// 只推进混合权重，淡出照常完成，视图沿用上一次评估的结果
+				CameraMode->UpdateBlending(DeltaTime);
+				INC_DWORD_STAT(STAT_NamiCamera_SkippedModeTicks);
+			}
+			else
+			{
+				NAMI_CAMERA_SCOPE_STAGE(ModeTick);
+				NAMI_CAMERA_SCOPE_OBJECT(CameraMode);
+				CameraMode->Tick(DeltaTime);
+			}
 
 			// 只在非栈顶模式权重为 0 时移除（已完全淡出）
 			// 栈顶模式 (Index 0) 永远不移除，它是当前活跃模式
@@ -199,87 +307,183 @@ bool FNamiCameraModeStack::UpdateStack(float DeltaTime)
 	return bHasValidCameraMode;
 }
 
-void FNamiCameraModeStack::BlendStack(FNamiCameraView& OutCameraModeView, float DeltaTime) const
+int32 FNamiCameraModeStack::GetBlendWeights(TArrayView<float> OutWeights) const
 {
+	const int32 Count = FMath::Min(CameraModeStack.Num(), OutWeights.Num());
+	for (int32 StackIndex = 0; StackIndex < Count; ++StackIndex)
+	{
+		const UNamiCameraModeBase* CameraMode = CameraModeStack[StackIndex];
+		OutWeights[StackIndex] = CameraMode ? CameraMode->GetBlendWeight() : 0.0f;
+	}
+	return Count;
+}
+
+void FNamiCameraModeStack::BlendStack(FNamiCameraView& OutCameraModeView, float DeltaTime)
+{
+	using namespace NamiCameraModeStack_Impl;
+
 	const int32 StackSize = CameraModeStack.Num();
 	if (StackSize <= 0)
 	{
 		return;
 	}
 
-	// ========== 阶段0: 预计算所有 Mode 的混合权重（避免重复计算） ==========
-	// 权重数组：索引对应 CameraModeStack 的索引
-	TArray<float> PrecomputedWeights;
-	PrecomputedWeights.SetNumUninitialized(StackSize);
+	// 预计算所有 Mode 的有效贡献（内联分配，常见栈深度下不触发堆分配）
+	TArray<float, TInlineAllocator<8>> PrecomputedWeights;
+	ComputeContributions(PrecomputedWeights);
+
+	// 按引用收集各 Mode 的 View，索引与 CameraModeStack 一致
+	TArray<const FNamiCameraView*, TInlineAllocator<8>> ModeViews;
+	ModeViews.SetNumUninitialized(StackSize);
+	for (int32 StackIndex = 0; StackIndex < StackSize; ++StackIndex)
+	{
+		check(CameraModeStack[StackIndex]);
+		ModeViews[StackIndex] = &CameraModeStack[StackIndex]->GetView();
+	}
+
+	// 冻结快照作为最底层参与混合
+	if (bHasCollapsedSnapshot)
+	{
+		ModeViews.Add(&CollapsedView);
+		PrecomputedWeights.Add(CollapsedWeight);
+	}
+	const int32 NumLayers = ModeViews.Num();
+
+	// 参数空间混合：栈底与所有贡献大于 0 的模式都提供状态时使用
+	if (GParameterSpaceBlend && !GSequentialBlend)
+	{
+		TArray<const FNamiCameraState*, TInlineAllocator<8>> ModeStates;
+		ModeStates.SetNumUninitialized(NumLayers);
+		bool bAllStates = true;
+		for (int32 LayerIndex = 0; LayerIndex < NumLayers; ++LayerIndex)
+		{
+			ModeStates[LayerIndex] = LayerIndex < StackSize ? CameraModeStack[LayerIndex]->GetCameraState() : &CollapsedState;
+			const bool bParticipates = LayerIndex == NumLayers - 1 || PrecomputedWeights[LayerIndex] > 0.0f;
+			if (bParticipates && !ModeStates[LayerIndex])
+			{
+				bAllStates = false;
+				break;
+			}
+		}
+
+		if (bAllStates)
+		{
+			FNamiCameraBlendKernel::BlendStates(ModeStates, ModeViews, PrecomputedWeights, BlendedState, OutCameraModeView);
+			return;
+		}
+	}
+
+	if (GSequentialBlend)
+	{
+		FNamiCameraBlendKernel::BlendSequential(ModeViews, PrecomputedWeights, OutCameraModeView);
+	}
+	else
+	{
+		FNamiCameraBlendKernel::Blend(ModeViews, PrecomputedWeights, OutCameraModeView);
+	}
+}
+
+void FNamiCameraModeStack::ComputeContributions(TArray<float, TInlineAllocator<8>>& OutContributions) const
+{
+	const int32 StackSize = CameraModeStack.Num();
+	OutContributions.SetNumUninitialized(StackSize);
 
 	// 从栈底到栈顶计算权重
 	// 栈底 (StackSize-1) 的权重就是它自己的 BlendWeight
 	// 其他 Mode 的权重 = 自己的 BlendWeight * (1 - 后面所有 Mode 的 BlendWeight 的乘积)
-	float AccumulatedWeight = 1.0f;
+	// 冻结快照在所有模式之下，合并时其权重取被合并模式的等效权重，保证合并前后各模式贡献不变
+	float AccumulatedWeight = bHasCollapsedSnapshot ? 1.0f - CollapsedWeight : 1.0f;
 	for (int32 StackIndex = StackSize - 1; StackIndex >= 0; --StackIndex)
 	{
 		const float ModeBlendWeight = CameraModeStack[StackIndex]->GetBlendWeight();
-		PrecomputedWeights[StackIndex] = ModeBlendWeight * AccumulatedWeight;
+		OutContributions[StackIndex] = ModeBlendWeight * AccumulatedWeight;
 		AccumulatedWeight *= (1.0f - ModeBlendWeight);
 	}
+}
 
-	// ========== 阶段1: PivotLocation 混合 ==========
-	// 使用每个 Mode 的 View 中的 PivotLocation（已经包含了所有偏移）
-	FVector BlendedPivotLocation = FVector::ZeroVector;
-	float TotalWeight = 0.0f;
+void FNamiCameraModeStack::EnforceMaxDepth()
+{
+	using namespace NamiCameraModeStack_Impl;
 
-	// 从栈底到栈顶遍历
-	for (int32 StackIndex = StackSize - 1; StackIndex >= 0; --StackIndex)
+	const int32 EffectiveMaxDepth = GMaxDepthOverride >= 0 ? GMaxDepthOverride : MaxDepth;
+	const int32 StackSize = CameraModeStack.Num();
+	if (EffectiveMaxDepth <= 0 || StackSize <= EffectiveMaxDepth)
 	{
-		const float ModeWeight = PrecomputedWeights[StackIndex];
-		if (ModeWeight > 0.0f)
-		{
-			const FVector ModePivotLocation = CameraModeStack[StackIndex]->GetView().PivotLocation;
-			if (TotalWeight <= 0.0f)
-			{
-				// 第一个有效权重，直接设置
-				BlendedPivotLocation = ModePivotLocation;
-				TotalWeight = ModeWeight;
-			}
-			else
-			{
-				// 线性插值混合
-				const float BlendAlpha = ModeWeight / (TotalWeight + ModeWeight);
-				BlendedPivotLocation = FMath::Lerp(BlendedPivotLocation, ModePivotLocation, BlendAlpha);
-				TotalWeight += ModeWeight;
-			}
-		}
+		return;
 	}
 
-	// 如果所有权重都为 0，使用栈底 Mode 的 PivotLocation
-	if (TotalWeight <= 0.0f)
+	// 被合并的模式（连同已有快照）按当前贡献混合为一个视图，与完整混合中这些层的中间结果一致
+	TArray<float, TInlineAllocator<8>> Contributions;
+	ComputeContributions(Contributions);
+
+	TArray<const FNamiCameraView*, TInlineAllocator<8>> TailViews;
+	TArray<float, TInlineAllocator<8>> TailContributions;
+	float Residual = bHasCollapsedSnapshot ? 1.0f - CollapsedWeight : 1.0f;
+	for (int32 StackIndex = EffectiveMaxDepth; StackIndex < StackSize; ++StackIndex)
+	{
+		TailViews.Add(&CameraModeStack[StackIndex]->GetView());
+		TailContributions.Add(Contributions[StackIndex]);
+		Residual *= 1.0f - CameraModeStack[StackIndex]->GetBlendWeight();
+	}
+	if (bHasCollapsedSnapshot)
 	{
-		BlendedPivotLocation = CameraModeStack[StackSize - 1]->GetView().PivotLocation;
+		TailViews.Add(&CollapsedView);
+		TailContributions.Add(CollapsedWeight);
 	}
 
-	// ========== 阶段2: 混合完整 View ==========
-	// 获取栈底 Mode 的 View（作为基础）
-	const UNamiCameraModeBase* BaseCameraMode = CameraModeStack[StackSize - 1];
-	check(BaseCameraMode);
-	OutCameraModeView = BaseCameraMode->GetView();
-	OutCameraModeView.PivotLocation = BlendedPivotLocation;
+	FNamiCameraView SnapshotView;
+	if (GSequentialBlend)
+	{
+		FNamiCameraBlendKernel::BlendSequential(TailViews, TailContributions, SnapshotView);
+	}
+	else
+	{
+		FNamiCameraBlendKernel::Blend(TailViews, TailContributions, SnapshotView);
+	}
 
-	// 混合其他 Mode 的 View（从栈底到栈顶，跳过栈底）
-	for (int32 StackIndex = StackSize - 2; StackIndex >= 0; --StackIndex)
+	const int32 NumCollapsed = StackSize - EffectiveMaxDepth;
+	for (int32 StackIndex = StackSize - 1; StackIndex >= EffectiveMaxDepth; --StackIndex)
 	{
-		const float ModeWeight = PrecomputedWeights[StackIndex];
-		if (ModeWeight > 0.0f)
-		{
-			const UNamiCameraModeBase* CameraMode = CameraModeStack[StackIndex];
-			check(CameraMode);
+		CameraModeStack[StackIndex]->Deactivate();
+		CameraModeStack.RemoveAt(StackIndex);
+	}
 
-			// 混合 View（但 PivotLocation 已经混合好了）
-			FNamiCameraView OtherView = CameraMode->GetView();
-			OtherView.PivotLocation = BlendedPivotLocation;
-			OutCameraModeView.Blend(OtherView, ModeWeight);
+	CollapsedView = SnapshotView;
+	CollapsedState.SetFromView(SnapshotView);
+	CollapsedWeight = FMath::Clamp(1.0f - Residual, 0.0f, 1.0f);
+	bHasCollapsedSnapshot = true;
 
-			// 确保 PivotLocation 保持为混合后的值
-			OutCameraModeView.PivotLocation = BlendedPivotLocation;
-		}
+	// 快照按栈顶模式的混合时间淡出
+	CollapsedBlend.SetBlendOption(EAlphaBlendOption::Linear);
+	CollapsedBlend.SetBlendTime(FMath::Max(CameraModeStack[0]->BlendConfig.BlendTime, 0.0f));
+	CollapsedBlend.SetValueRange(CollapsedWeight, 0.0f);
+	CollapsedBlend.SetAlpha(0.0f);
+
+	INC_DWORD_STAT_BY(STAT_NamiCamera_CollapsedModes, NumCollapsed);
+	INC_DWORD_STAT(STAT_NamiCamera_ModeStackCollapses);
+
+	NAMI_LOG_MODE_BLEND(Log,
+		TEXT("[FNamiCameraModeStack::EnforceMaxDepth] Collapsed %d modes into snapshot (MaxDepth=%d, SnapshotWeight=%.3f)"),
+		NumCollapsed, EffectiveMaxDepth, CollapsedWeight);
+}
+
+void FNamiCameraModeStack::UpdateCollapsedSnapshot(float DeltaTime)
+{
+	if (!bHasCollapsedSnapshot)
+	{
+		return;
 	}
+
+	CollapsedBlend.Update(DeltaTime);
+	CollapsedWeight = FMath::Clamp(CollapsedBlend.GetBlendedValue(), 0.0f, 1.0f);
+	if (CollapsedWeight <= KINDA_SMALL_NUMBER)
+	{
+		ClearCollapsedSnapshot();
+	}
+}
+
+void FNamiCameraModeStack::ClearCollapsedSnapshot()
+{
+	bHasCollapsedSnapshot = false;
+	CollapsedWeight = 0.0f;
 }
@@ -0,0 +1,743 @@
+// Copyright Qiu, Inc. All Rights Reserved.
+
+#include "Core/NamiCameraReplay.h"
+
+#include "Adjustments/NamiCameraAdjust.h"
+#include "Adjustments/NamiCameraAdjustLayer.h"
+#include "CameraModes/NamiDualFocusCameraMode.h"
+#include "Components/NamiCameraComponent.h"
+#include "Core/LogNamiCamera.h"
+#include "Core/NamiCameraBenchmark.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "ModeComponents/NamiCameraLockOnComponent.h"
+#include "ModeComponents/NamiTargetVisibilityComponent.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/UObjectIterator.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(NamiCameraReplay)
+
+namespace NamiCameraReplay_Impl
+{
+	static FString GetClassPath(const UObject* Object)
+	{
+		return Object ? Object->GetClass()->GetPathName() : FString();
+	}
+
+	/** 调整器配置中静态参数的键（以非标识符字符开头，不会与属性名冲突） */
+	static const TCHAR* StaticParamsKey = TEXT("@StaticParams");
+
+	/** 与 UNamiCameraAdjust::ResetForReuse 相同的配置属性范围，委托不参与回放 */
+	static bool IsAdjustConfigProperty(const FProperty* Property)
+	{
+		return Property->HasAnyPropertyFlags(CPF_Edit | CPF_BlueprintVisible)
+			&& !Property->HasAnyPropertyFlags(CPF_BlueprintAssignable);
+	}
+
+	/** 栈顶模式使用的锁定目标提供者 */
+	static INamiLockOnTargetProvider* FindLockOnProvider(const UNamiCameraComponent& CameraComponent)
+	{
+		const TArray<TObjectPtr<UNamiCameraModeBase>>& Modes = CameraComponent.GetBlendingStack().GetCameraModes();
+		UNamiCameraModeBase* TopMode = Modes.Num() > 0 ? Modes[0].Get() : nullptr;
+		if (!TopMode)
+		{
+			return nullptr;
+		}
+
+		if (const UNamiDualFocusCameraMode* DualFocusMode = Cast<UNamiDualFocusCameraMode>(TopMode))
+		{
+			return DualFocusMode->GetLockOnProvider().GetInterface();
+		}
+		if (const UNamiCameraLockOnComponent* LockOnComponent = TopMode->GetComponent<UNamiCameraLockOnComponent>())
+		{
+			return LockOnComponent->GetLockOnProvider().GetInterface();
+		}
+		return nullptr;
+	}
+
+	/** 将回放提供者设置到堆栈中所有使用锁定目标的模式与组件 */
+	static void AssignLockOnProvider(UNamiCameraComponent* CameraComponent, UNamiCameraReplayLockOnProvider* Provider)
+	{
+		const TScriptInterface<INamiLockOnTargetProvider> ProviderInterface(Provider);
+		for (UNamiCameraModeBase* Mode : CameraComponent->GetBlendingStack().GetCameraModes())
+		{
+			if (!Mode)
+			{
+				continue;
+			}
+			if (UNamiDualFocusCameraMode* DualFocusMode = Cast<UNamiDualFocusCameraMode>(Mode))
+			{
+				DualFocusMode->SetLockOnProvider(ProviderInterface);
+			}
+			if (UNamiCameraLockOnComponent* LockOnComponent = Mode->GetComponent<UNamiCameraLockOnComponent>())
+			{
+				LockOnComponent->SetLockOnProvider(ProviderInterface);
+			}
+			if (UNamiTargetVisibilityComponent* VisibilityComponent = Mode->GetComponent<UNamiTargetVisibilityComponent>())
+			{
+				VisibilityComponent->SetLockOnProvider(ProviderInterface);
+			}
+		}
+	}
+
+	/** 执行一个回放事件 */
+	static bool ApplyEvent(UNamiCameraComponent* CameraComponent, const FNamiCameraReplayEvent& Event)
+	{
+		switch (Event.Type)
+		{
+		case ENamiCameraReplayEventType::PushMode:
+			{
+				UClass* ModeClass = LoadClass<UNamiCameraModeBase>(nullptr, *Event.ClassPath);
+				return ModeClass && CameraComponent->PushCameraMode(ModeClass, Event.Value).IsValid();
+			}
+
+		case ENamiCameraReplayEventType::PopMode:
+			{
+				const TArray<FNamiCameraModeStackEntry>& PriorityStack = CameraComponent->GetCameraModePriorityStack();
+				return PriorityStack.IsValidIndex(Event.Value)
+					&& CameraComponent->PopCameraModeInstance(PriorityStack[Event.Value].CameraMode.Get());
+			}
+
+		case ENamiCameraReplayEventType::PushAdjust:
+			{
+				UClass* AdjustClass = LoadClass<UNamiCameraAdjust>(nullptr, *Event.ClassPath);
+				if (!AdjustClass)
+				{
+					return false;
+				}
+
+				// 先恢复配置再推送：Priority 决定插入位置，BlendInTime 等在激活时读取
+				UNamiCameraAdjust* AdjustInstance = NewObject<UNamiCameraAdjust>(CameraComponent, AdjustClass);
+				const bool bConfigApplied = FNamiCameraReplay::ImportAdjustConfig(Event.Payload, *AdjustInstance);
+				return CameraComponent->PushAdjustInstance(AdjustInstance, ENamiCameraAdjustDuplicatePolicy::AllowDuplicate) && bConfigApplied;
+			}
+
+		case ENamiCameraReplayEventType::PopAdjust:
+			{
+				const TArray<UNamiCameraAdjust*>& Adjusts = CameraComponent->GetAdjusts();
+				// 录制的是堆栈位置，GetAdjusts 保留 GC 清空的条目，索引保持一致
+				return Adjusts.IsValidIndex(Event.Value) && IsValid(Adjusts[Event.Value])
+					&& CameraComponent->PopAdjust(Adjusts[Event.Value], Event.bForceImmediate);
+			}
+
+		case ENamiCameraReplayEventType::PushLayer:
+			{
+				FNamiCameraAdjustLayer Layer;
+				return FNamiCameraReplay::ImportLayer(Event.Payload, Layer)
+					&& CameraComponent->PushAdjustLayer(Layer, static_cast<ENamiCameraAdjustDuplicatePolicy>(Event.Value)) != INDEX_NONE;
+			}
+
+		case ENamiCameraReplayEventType::PopLayer:
+			{
+				const TArray<FNamiCameraAdjustLayer>& Layers = CameraComponent->GetAdjustLayers();
+				return Layers.IsValidIndex(Event.Value) && CameraComponent->PopAdjustLayer(Layers[Event.Value].GetId(), Event.bForceImmediate);
+			}
+		}
+		return false;
+	}
+}
+
+// ========== FNamiCameraReplayFile ==========
+
+void FNamiCameraReplayFile::SerializeHeader(FArchive& Ar)
+{
+	uint32 Magic = FileMagic;
+	uint32 Version = FileVersion;
+	Ar << Magic << Version;
+	if (Ar.IsLoading() && (Magic != FileMagic || Version != FileVersion))
+	{
+		Ar.SetError();
+		return;
+	}
+
+	Ar << ComponentClassPath;
+
+	int32 NumModes = InitialModes.Num();
+	Ar << NumModes;
+	if (Ar.IsLoading())
+	{
+		if (NumModes < 0)
+		{
+			Ar.SetError();
+			return;
+		}
+		InitialModes.SetNum(NumModes);
+	}
+	for (FInitialMode& Mode : InitialModes)
+	{
+		Ar << Mode.ClassPath << Mode.Priority;
+	}
+
+	int32 NumAdjusts = InitialAdjusts.Num();
+	Ar << NumAdjusts;
+	if (Ar.IsLoading())
+	{
+		if (NumAdjusts < 0)
+		{
+			Ar.SetError();
+			return;
+		}
+		InitialAdjusts.SetNum(NumAdjusts);
+	}
+	for (FInitialAdjust& Adjust : InitialAdjusts)
+	{
+		Ar << Adjust.ClassPath << Adjust.Config;
+	}
+
+	Ar << InitialLayers;
+}
+
+void FNamiCameraReplayFile::SerializeFrame(FArchive& Ar, FNamiCameraReplayFrame& Frame)
+{
+	Ar << Frame.DeltaTime;
+	Ar << Frame.WorldTime;
+	Ar << Frame.PawnLocation << Frame.PawnRotation;
+	Ar << Frame.ControlRotation;
+	Ar << Frame.MouseDelta << Frame.LookInput;
+
+	uint8 bHasLockedTarget = Frame.bHasLockedTarget ? 1 : 0;
+	Ar << bHasLockedTarget;
+	Frame.bHasLockedTarget = bHasLockedTarget != 0;
+	if (Frame.bHasLockedTarget)
+	{
+		Ar << Frame.LockedLocation << Frame.LockedFocusLocation;
+	}
+
+	int32 NumEvents = Frame.Events.Num();
+	Ar << NumEvents;
+	if (Ar.IsLoading())
+	{
+		if (NumEvents < 0)
+		{
+			Ar.SetError();
+			return;
+		}
+		Frame.Events.SetNum(NumEvents);
+	}
+	for (FNamiCameraReplayEvent& Event : Frame.Events)
+	{
+		uint8 Type = static_cast<uint8>(Event.Type);
+		uint8 bForceImmediate = Event.bForceImmediate ? 1 : 0;
+		Ar << Type << Event.ClassPath << Event.Value << bForceImmediate << Event.Payload;
+		Event.Type = static_cast<ENamiCameraReplayEventType>(Type);
+		Event.bForceImmediate = bForceImmediate != 0;
+	}
+}
+
+bool FNamiCameraReplayFile::LoadFromFile(const FString& FilePath)
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *FilePath))
+	{
+		UE_LOG(LogNamiCamera, Error, TEXT("[FNamiCameraReplayFile::LoadFromFile] Failed to read %s"), *FilePath);
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+	SerializeHeader(Reader);
+
+	int32 NumFrames = 0;
+	Reader << NumFrames;
+	if (Reader.IsError() || NumFrames < 0)
+	{
+		UE_LOG(LogNamiCamera, Error, TEXT("[FNamiCameraReplayFile::LoadFromFile] %s is not a valid replay (version %u expected)"), *FilePath, FileVersion);
+		return false;
+	}
+
+	Frames.SetNum(NumFrames);
+	for (FNamiCameraReplayFrame& Frame : Frames)
+	{
+		SerializeFrame(Reader, Frame);
+		if (Reader.IsError())
+		{
+			UE_LOG(LogNamiCamera, Error, TEXT("[FNamiCameraReplayFile::LoadFromFile] %s is truncated"), *FilePath);
+			return false;
+		}
+	}
+	return true;
+}
+
+// ========== FNamiCameraReplayRecorder ==========
+
+void FNamiCameraReplayRecorder::Start(const UNamiCameraComponent& CameraComponent)
+{
+	using namespace NamiCameraReplay_Impl;
+
+	Header = FNamiCameraReplayFile();
+	Header.ComponentClassPath = GetClassPath(&CameraComponent);
+	for (const FNamiCameraModeStackEntry& Entry : CameraComponent.GetCameraModePriorityStack())
+	{
+		if (Entry.CameraMode.IsValid())
+		{
+			FNamiCameraReplayFile::FInitialMode& Mode = Header.InitialModes.AddDefaulted_GetRef();
+			Mode.ClassPath = GetClassPath(Entry.CameraMode.Get());
+			Mode.Priority = Entry.Priority;
+		}
+	}
+	for (const UNamiCameraAdjust* Adjust : CameraComponent.GetAdjusts())
+	{
+		if (IsValid(Adjust) && !Adjust->IsBlendingOut())
+		{
+			FNamiCameraReplayFile::FInitialAdjust& InitialAdjust = Header.InitialAdjusts.AddDefaulted_GetRef();
+			InitialAdjust.ClassPath = GetClassPath(Adjust);
+			InitialAdjust.Config = FNamiCameraReplay::ExportAdjustConfig(*Adjust);
+		}
+	}
+	for (const FNamiCameraAdjustLayer& Layer : CameraComponent.GetAdjustLayers())
+	{
+		if (!Layer.IsBlendingOut() && !Layer.IsFullyInactive())
+		{
+			Header.InitialLayers.Add(FNamiCameraReplay::ExportLayer(Layer));
+		}
+	}
+
+	FrameBuffer.Reset();
+	NumFrames = 0;
+	PendingEvents.Reset();
+	ScratchFrame.Events.Reset();
+	bRecording = true;
+
+	UE_LOG(LogNamiCamera, Log, TEXT("[FNamiCameraReplayRecorder] Started recording %s"), *GetNameSafe(CameraComponent.GetOwner()));
+}
+
+bool FNamiCameraReplayRecorder::Stop(const FString& FilePath)
+{
+	if (!bRecording)
+	{
+		return false;
+	}
+	bRecording = false;
+
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	Header.SerializeHeader(Writer);
+	Writer << NumFrames;
+	Bytes.Append(FrameBuffer);
+
+	FrameBuffer.Empty();
+	PendingEvents.Empty();
+	ScratchFrame.Events.Empty();
+
+	if (!FFileHelper::SaveArrayToFile(Bytes, *FilePath))
+	{
+		UE_LOG(LogNamiCamera, Error, TEXT("[FNamiCameraReplayRecorder] Failed to write %s"), *FilePath);
+		return false;
+	}
+
+	UE_LOG(LogNamiCamera, Log, TEXT("[FNamiCameraReplayRecorder] Wrote %d frames (%d bytes) to %s"), NumFrames, Bytes.Num(), *FilePath);
+	return true;
+}
+
+void FNamiCameraReplayRecorder::RecordEvent(ENamiCameraReplayEventType Type, const UObject* ClassSource, int32 Value, bool bForceImmediate, FString Payload)
+{
+	FNamiCameraReplayEvent& Event = PendingEvents.AddDefaulted_GetRef();
+	Event.Type = Type;
+	Event.ClassPath = NamiCameraReplay_Impl::GetClassPath(ClassSource);
+	Event.Value = Value;
+	Event.bForceImmediate = bForceImmediate;
+	Event.Payload = MoveTemp(Payload);
+}
+
+void FNamiCameraReplayRecorder::CaptureFrame(const UNamiCameraComponent& CameraComponent, float DeltaTime)
+{
+	FNamiCameraReplayFrame& Frame = ScratchFrame;
+	Frame.DeltaTime = DeltaTime;
+	Frame.WorldTime = CameraComponent.GetCameraTimeSeconds();
+
+	if (const APawn* Pawn = CameraComponent.GetOwnerPawn())
+	{
+		Frame.PawnLocation = Pawn->GetActorLocation();
+		Frame.PawnRotation = Pawn->GetActorRotation();
+	}
+	if (const APlayerController* PC = CameraComponent.GetOwnerPlayerController())
+	{
+		Frame.ControlRotation = PC->GetControlRotation();
+	}
+
+	float TurnInput = 0.0f;
+	float LookInput = 0.0f;
+	CameraComponent.GetInputMouseDelta(TurnInput, LookInput);
+	Frame.MouseDelta = FVector2D(TurnInput, LookInput);
+	Frame.LookInput = CameraComponent.GetInputSnapshot().LookInput;
+
+	const INamiLockOnTargetProvider* Provider = NamiCameraReplay_Impl::FindLockOnProvider(CameraComponent);
+	Frame.bHasLockedTarget = Provider && Provider->HasLockedTarget();
+	if (Frame.bHasLockedTarget)
+	{
+		Frame.LockedLocation = Provider->GetLockedLocation();
+		Frame.LockedFocusLocation = Provider->GetLockedFocusLocation();
+	}
+
+	// 交换事件缓冲：本帧写出待写事件，旧缓冲留作下一帧收集
+	Swap(Frame.Events, PendingEvents);
+	PendingEvents.Reset();
+
+	FMemoryWriter Writer(FrameBuffer, false, true);
+	FNamiCameraReplayFile::SerializeFrame(Writer, Frame);
+	++NumFrames;
+}
+
+// ========== FNamiCameraReplay ==========
+
+bool FNamiCameraReplayResult::SaveViewsToCsv(const FString& FilePath) const
+{
+	FString Csv = TEXT("Frame,LocX,LocY,LocZ,Pitch,Yaw,Roll,FOV\n");
+	for (int32 Frame = 0; Frame < Views.Num(); ++Frame)
+	{
+		const FMinimalViewInfo& View = Views[Frame];
+		Csv += FString::Printf(TEXT("%d,%.6f,%.6f,%.6f,%.6f,%.6f,%.6f,%.6f\n"), Frame,
+			View.Location.X, View.Location.Y, View.Location.Z,
+			View.Rotation.Pitch, View.Rotation.Yaw, View.Rotation.Roll, View.FOV);
+	}
+	return FFileHelper::SaveStringToFile(Csv, *FilePath);
+}
+
+bool FNamiCameraReplay::Run(UWorld* World, const FNamiCameraReplayFile& Replay, FNamiCameraReplayResult& OutResult)
+{
+	using namespace NamiCameraReplay_Impl;
+
+	if (!World || Replay.Frames.Num() == 0)
+	{
+		UE_LOG(LogNamiCamera, Error, TEXT("[FNamiCameraReplay::Run] Invalid world or empty replay"));
+		return false;
+	}
+
+	FNamiCameraScenarioActors Actors;
+	if (!Actors.Spawn(World))
+	{
+		UE_LOG(LogNamiCamera, Error, TEXT("[FNamiCameraReplay::Run] Failed to spawn replay actors"));
+		Actors.Destroy();
+		return false;
+	}
+
+	UClass* ComponentClass = LoadClass<UNamiCameraComponent>(nullptr, *Replay.ComponentClassPath);
+	if (!ComponentClass)
+	{
+		UE_LOG(LogNamiCamera, Warning, TEXT("[FNamiCameraReplay::Run] Component class %s not found, using UNamiCameraComponent"), *Replay.ComponentClassPath);
+		ComponentClass = UNamiCameraComponent::StaticClass();
+	}
+
+	UNamiCameraComponent* CameraComp = NewObject<UNamiCameraComponent>(Actors.Pawn, ComponentClass, NAME_None, RF_Transient);
+	CameraComp->SetupAttachment(Actors.Pawn->GetRootComponent());
+	CameraComp->RegisterComponent();
+
+	// 帧预算按墙钟耗时降级，回放时会随机器负载改变结果，固定为不降级
+	CameraComp->SetFrameBudgetSuspended(true);
+
+	// 清空 BeginPlay 推送的默认模式，按录制开始时的堆栈重建
+	while (CameraComp->GetCameraModePriorityStack().Num() > 0)
+	{
+		if (!CameraComp->PopCameraModeInstance(CameraComp->GetCameraModePriorityStack().Last().CameraMode.Get()))
+		{
+			break;
+		}
+	}
+	for (const FNamiCameraReplayFile::FInitialMode& Mode : Replay.InitialModes)
+	{
+		FNamiCameraReplayEvent Event;
+		Event.Type = ENamiCameraReplayEventType::PushMode;
+		Event.ClassPath = Mode.ClassPath;
+		Event.Value = Mode.Priority;
+		ApplyEvent(CameraComp, Event);
+	}
+	for (const FNamiCameraReplayFile::FInitialAdjust& Adjust : Replay.InitialAdjusts)
+	{
+		FNamiCameraReplayEvent Event;
+		Event.Type = ENamiCameraReplayEventType::PushAdjust;
+		Event.ClassPath = Adjust.ClassPath;
+		Event.Payload = Adjust.Config;
+		ApplyEvent(CameraComp, Event);
+	}
+	for (const FString& LayerText : Replay.InitialLayers)
+	{
+		FNamiCameraReplayEvent Event;
+		Event.Type = ENamiCameraReplayEventType::PushLayer;
+		Event.Value = static_cast<int32>(ENamiCameraAdjustDuplicatePolicy::AllowDuplicate);
+		Event.Payload = LayerText;
+		ApplyEvent(CameraComp, Event);
+	}
+
+	TStrongObjectPtr<UNamiCameraReplayLockOnProvider> Provider(NewObject<UNamiCameraReplayLockOnProvider>());
+	AssignLockOnProvider(CameraComp, Provider.Get());
+
+	OutResult.Views.Reset(Replay.Frames.Num());
+	OutResult.PipelineSeconds = 0.0;
+
+	int32 FailedEvents = 0;
+	uint64 PipelineCycles = 0;
+	FMinimalViewInfo View;
+
+	for (const FNamiCameraReplayFrame& Frame : Replay.Frames)
+	{
+		if (Frame.Events.Num() > 0)
+		{
+			for (const FNamiCameraReplayEvent& Event : Frame.Events)
+			{
+				if (!ApplyEvent(CameraComp, Event))
+				{
+					++FailedEvents;
+				}
+			}
+			AssignLockOnProvider(CameraComp, Provider.Get());
+		}
+
+		Actors.Pawn->SetActorLocationAndRotation(Frame.PawnLocation, Frame.PawnRotation);
+		Actors.PC->SetControlRotation(Frame.ControlRotation);
+		CameraComp->SetInputMouseDeltaOverride(Frame.MouseDelta);
+		CameraComp->SetLookInputOverride(Frame.LookInput);
+		CameraComp->SetTimeSecondsOverride(Frame.WorldTime);
+		Provider->bHasLockedTarget = Frame.bHasLockedTarget;
+		Provider->LockedLocation = Frame.LockedLocation;
+		Provider->LockedFocusLocation = Frame.LockedFocusLocation;
+
+		const uint64 CyclesBefore = FPlatformTime::Cycles64();
+		CameraComp->GetCameraView(Frame.DeltaTime, View);
+		PipelineCycles += FPlatformTime::Cycles64() - CyclesBefore;
+
+		OutResult.Views.Add(View);
+	}
+
+	OutResult.PipelineSeconds = FPlatformTime::ToSeconds64(PipelineCycles);
+
+	if (FailedEvents > 0)
+	{
+		UE_LOG(LogNamiCamera, Warning, TEXT("[FNamiCameraReplay::Run] %d events could not be applied (missing class or index)"), FailedEvents);
+	}
+
+	CameraComp->DestroyComponent();
+	Actors.Destroy();
+	return true;
+}
+
+FString FNamiCameraReplay::ExportLayer(const FNamiCameraAdjustLayer& Layer)
+{
+	FString Text;
+	FNamiCameraAdjustLayer::StaticStruct()->ExportText(Text, &Layer, nullptr, nullptr, PPF_None, nullptr);
+	return Text;
+}
+
+bool FNamiCameraReplay::ImportLayer(const FString& Text, FNamiCameraAdjustLayer& OutLayer)
+{
+	const UScriptStruct* LayerStruct = FNamiCameraAdjustLayer::StaticStruct();
+	if (!LayerStruct->ImportText(*Text, &OutLayer, nullptr, PPF_None, GLog, LayerStruct->GetName()))
+	{
+		UE_LOG(LogNamiCamera, Warning, TEXT("[FNamiCameraReplay::ImportLayer] Failed to import layer: %s"), *Text);
+		return false;
+	}
+	return true;
+}
+
+FString FNamiCameraReplay::ExportAdjustConfig(const UNamiCameraAdjust& Adjust)
+{
+	using namespace NamiCameraReplay_Impl;
+
+	FString Text;
+	const UObject* Defaults = Adjust.GetClass()->GetDefaultObject();
+	for (TFieldIterator<FProperty> It(Adjust.GetClass()); It; ++It)
+	{
+		const FProperty* Property = *It;
+		if (!IsAdjustConfigProperty(Property) || Property->Identical_InContainer(&Adjust, Defaults))
+		{
+			continue;
+		}
+
+		if (Property->HasAnyPropertyFlags(CPF_InstancedReference | CPF_ContainsInstancedReference))
+		{
+			UE_LOG(LogNamiCamera, Warning, TEXT("[FNamiCameraReplay::ExportAdjustConfig] %s.%s differs from class default but instanced subobjects are not replayed"),
+				*Adjust.GetClass()->GetName(), *Property->GetName());
+			continue;
+		}
+
+		FString Value;
+		Property->ExportText_InContainer(0, Value, &Adjust, Defaults, nullptr, PPF_Delimited);
+		Text += FString::Printf(TEXT("%s=%s\n"), *Property->GetName(), *Value);
+	}
+
+	if (Adjust.IsUsingStaticParams())
+	{
+		FString Value;
+		FNamiCameraAdjustParams::StaticStruct()->ExportText(Value, &Adjust.GetStaticParams(), nullptr, nullptr, PPF_Delimited, nullptr);
+		Text += FString::Printf(TEXT("%s=%s\n"), StaticParamsKey, *Value);
+	}
+	return Text;
+}
+
+bool FNamiCameraReplay::ImportAdjustConfig(const FString& Text, UNamiCameraAdjust& Adjust)
+{
+	using namespace NamiCameraReplay_Impl;
+
+	TArray<FString> Lines;
+	Text.ParseIntoArrayLines(Lines);
+
+	bool bSuccess = true;
+	for (const FString& Line : Lines)
+	{
+		FString Key;
+		FString Value;
+		if (!Line.Split(TEXT("="), &Key, &Value))
+		{
+			bSuccess = false;
+			continue;
+		}
+
+		if (Key == StaticParamsKey)
+		{
+			FNamiCameraAdjustParams Params;
+			const UScriptStruct* ParamsStruct = FNamiCameraAdjustParams::StaticStruct();
+			if (ParamsStruct->ImportText(*Value, &Params, nullptr, PPF_Delimited, GLog, ParamsStruct->GetName()))
+			{
+				Adjust.SetStaticParams(Params);
+				continue;
+			}
+		}
+		else if (const FProperty* Property = FindFProperty<FProperty>(Adjust.GetClass(), *Key))
+		{
+			if (IsAdjustConfigProperty(Property)
+				&& Property->ImportText_InContainer(*Value, &Adjust, &Adjust, PPF_Delimited) != nullptr)
+			{
+				continue;
+			}
+		}
+
+		UE_LOG(LogNamiCamera, Warning, TEXT("[FNamiCameraReplay::ImportAdjustConfig] Failed to import %s for %s"),
+			*Key, *Adjust.GetClass()->GetName());
+		bSuccess = false;
+	}
+	return bSuccess;
+}
+
+// ========== 控制台命令 ==========
+
+static FAutoConsoleCommandWithArgs GNamiCameraReplayRecordCommand(
+	TEXT("NamiCamera.Replay.Record"),
+	TEXT("开始/停止录制所有相机组件的管线输入。用法：NamiCamera.Replay.Record Start|Stop [File=路径]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const bool bStart = Args.Num() > 0 && Args[0].Equals(TEXT("Start"), ESearchCase::IgnoreCase);
+		const bool bStop = Args.Num() > 0 && Args[0].Equals(TEXT("Stop"), ESearchCase::IgnoreCase);
+		if (!bStart && !bStop)
+		{
+			UE_LOG(LogNamiCamera, Warning, TEXT("[NamiCamera.Replay.Record] Usage: NamiCamera.Replay.Record Start|Stop [File=Path]"));
+			return;
+		}
+
+		FString FilePath;
+		FParse::Value(*FString::Join(Args, TEXT(" ")), TEXT("File="), FilePath);
+
+		int32 Count = 0;
+		for (TObjectIterator<UNamiCameraComponent> It; It; ++It)
+		{
+			UNamiCameraComponent* CameraComponent = *It;
+			const UWorld* World = CameraComponent->GetWorld();
+			if (!World || !World->IsGameWorld() || CameraComponent->IsTemplate())
+			{
+				continue;
+			}
+
+			if (bStart)
+			{
+				CameraComponent->StartReplayRecording();
+				++Count;
+			}
+			else if (CameraComponent->IsReplayRecording())
+			{
+				// 多个组件同时录制时，在指定文件名后附加所有者名称
+				FString OutPath = FilePath;
+				if (!OutPath.IsEmpty() && Count > 0)
+				{
+					OutPath = FPaths::GetPath(FilePath) / FString::Printf(TEXT("%s_%s.%s"),
+						*FPaths::GetBaseFilename(FilePath), *GetNameSafe(CameraComponent->GetOwner()), *FPaths::GetExtension(FilePath));
+				}
+				CameraComponent->StopReplayRecording(OutPath);
+				++Count;
+			}
+		}
+
+		UE_LOG(LogNamiCamera, Display, TEXT("[NamiCamera.Replay.Record] %s %d camera components"), bStart ? TEXT("Started") : TEXT("Stopped"), Count);
+	}));
+
+static FAutoConsoleCommandWithWorldAndArgs GNamiCameraReplayPlayCommand(
+	TEXT("NamiCamera.Replay.Play"),
+	TEXT("在无头场景中回放录制文件并输出视图 CSV。参数：File=路径 Out=CSV路径 Repeat=N（N>1 时输出吞吐并校验确定性）"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (!World || !World->IsGameWorld())
+		{
+			UE_LOG(LogNamiCamera, Error, TEXT("[NamiCamera.Replay.Play] Requires a game world"));
+			return;
+		}
+
+		const FString CmdLine = FString::Join(Args, TEXT(" "));
+		FString FilePath;
+		if (!FParse::Value(*CmdLine, TEXT("File="), FilePath))
+		{
+			UE_LOG(LogNamiCamera, Warning, TEXT("[NamiCamera.Replay.Play] Usage: NamiCamera.Replay.Play File=Path [Out=Csv] [Repeat=N]"));
+			return;
+		}
+
+		FString OutPath = FPaths::ChangeExtension(FilePath, TEXT("csv"));
+		int32 Repeat = 1;
+		FParse::Value(*CmdLine, TEXT("Out="), OutPath);
+		FParse::Value(*CmdLine, TEXT("Repeat="), Repeat);
+		Repeat = FMath::Max(Repeat, 1);
+
+		FNamiCameraReplayFile Replay;
+		if (!Replay.LoadFromFile(FilePath))
+		{
+			return;
+		}
+
+		FNamiCameraReplayResult Reference;
+		for (int32 Run = 0; Run < Repeat; ++Run)
+		{
+			FNamiCameraReplayResult Result;
+			if (!FNamiCameraReplay::Run(World, Replay, Result))
+			{
+				return;
+			}
+
+			const int32 NumFrames = Result.Views.Num();
+			UE_LOG(LogNamiCamera, Display, TEXT("[NamiCamera.Replay.Play] Run %d: %d frames, %.3f ms pipeline, %.2f us/frame, %.0f frames/s"),
+				Run, NumFrames, Result.PipelineSeconds * 1000.0,
+				Result.PipelineSeconds * 1.0e6 / NumFrames,
+				Result.PipelineSeconds > 0.0 ? NumFrames / Result.PipelineSeconds : 0.0);
+
+			if (Run == 0)
+			{
+				Reference = MoveTemp(Result);
+				continue;
+			}
+
+			// 校验确定性：同一输入多次回放的视图应逐位一致
+			int32 Mismatches = 0;
+			for (int32 Frame = 0; Frame < NumFrames && Frame < Reference.Views.Num(); ++Frame)
+			{
+				const FMinimalViewInfo& A = Reference.Views[Frame];
+				const FMinimalViewInfo& B = Result.Views[Frame];
+				if (A.Location != B.Location || A.Rotation != B.Rotation || A.FOV != B.FOV)
+				{
+					++Mismatches;
+				}
+			}
+			if (Mismatches > 0)
+			{
+				UE_LOG(LogNamiCamera, Warning, TEXT("[NamiCamera.Replay.Play] Run %d differs from run 0 in %d frames"), Run, Mismatches);
+			}
+		}
+
+		if (Reference.SaveViewsToCsv(OutPath))
+		{
+			UE_LOG(LogNamiCamera, Display, TEXT("[NamiCamera.Replay.Play] Wrote %d views to %s"), Reference.Views.Num(), *OutPath);
+		}
+		else
+		{
+			UE_LOG(LogNamiCamera, Error, TEXT("[NamiCamera.Replay.Play] Failed to write %s"), *OutPath);
+		}
+	}));
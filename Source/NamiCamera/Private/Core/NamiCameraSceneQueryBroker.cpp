@@ -0,0 +1,83 @@
+// Copyright Qiu, Inc. All Rights Reserved.
+
+#include "Core/NamiCameraSceneQueryBroker.h"
+
+#include "CollisionQueryParams.h"
+#include "Core/NamiCameraStats.h"
+#include "Engine/HitResult.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+namespace NamiCameraSceneQueryBroker_Impl
+{
+	static int32 GSceneQueryBudgetOverride = -1;
+	static FAutoConsoleVariableRef CVarSceneQueryBudget(
+		TEXT("NamiCamera.SceneQueryBudget"),
+		GSceneQueryBudgetOverride,
+		TEXT("每个相机每帧的场景查询预算。-1=跟随组件设置，0=不限制，>0=上限（超出后推迟可延迟的查询）"),
+		ECVF_Default);
+}
+
+int32 FNamiCameraSceneQueryBroker::ResolveBudget(int32 ComponentBudget)
+{
+	using namespace NamiCameraSceneQueryBroker_Impl;
+	return GSceneQueryBudgetOverride >= 0 ? GSceneQueryBudgetOverride : FMath::Max(ComponentBudget, 0);
+}
+
+void FNamiCameraSceneQueryBroker::BeginFrame(int32 InBudget)
+{
+	Budget = InBudget;
+	NumSweeps = 0;
+	NumLineTraces = 0;
+	NumDeferred = 0;
+}
+
+void FNamiCameraSceneQueryBroker::EndFrame()
+{
+	LastSweeps = NumSweeps;
+	LastLineTraces = NumLineTraces;
+	LastDeferred = NumDeferred;
+}
+
+bool FNamiCameraSceneQueryBroker::TryAcquire(ENamiCameraSceneQueryPriority Priority)
+{
+	if (Priority == ENamiCameraSceneQueryPriority::Deferrable && Budget > 0 && NumSweeps + NumLineTraces >= Budget)
+	{
+		++NumDeferred;
+		INC_DWORD_STAT(STAT_NamiCamera_DeferredQueries);
+		return false;
+	}
+	return true;
+}
+
+ENamiCameraSceneQueryResult FNamiCameraSceneQueryBroker::SweepSingleByChannel(const UWorld* World, FHitResult& OutHit,
+	const FVector& Start, const FVector& End, const FQuat& Rot, ECollisionChannel TraceChannel,
+	const FCollisionShape& CollisionShape, const FCollisionQueryParams& Params, ENamiCameraSceneQueryPriority Priority)
+{
+	if (!TryAcquire(Priority))
+	{
+		return ENamiCameraSceneQueryResult::Deferred;
+	}
+
+	++NumSweeps;
+	INC_DWORD_STAT(STAT_NamiCamera_Sweeps);
+	return World->SweepSingleByChannel(OutHit, Start, End, Rot, TraceChannel, CollisionShape, Params)
+		? ENamiCameraSceneQueryResult::Hit
+		: ENamiCameraSceneQueryResult::Miss;
+}
+
+ENamiCameraSceneQueryResult FNamiCameraSceneQueryBroker::LineTraceSingleByChannel(const UWorld* World, FHitResult& OutHit,
+	const FVector& Start, const FVector& End, ECollisionChannel TraceChannel,
+	const FCollisionQueryParams& Params, ENamiCameraSceneQueryPriority Priority)
+{
+	if (!TryAcquire(Priority))
+	{
+		return ENamiCameraSceneQueryResult::Deferred;
+	}
+
+	++NumLineTraces;
+	INC_DWORD_STAT(STAT_NamiCamera_LineTraces);
+	return World->LineTraceSingleByChannel(OutHit, Start, End, TraceChannel, Params)
+		? ENamiCameraSceneQueryResult::Hit
+		: ENamiCameraSceneQueryResult::Miss;
+}
@@ -4,6 +4,8 @@
 #include "Core/LogNamiCamera.h"
 #include "Core/LogNamiCameraMacros.h"
 #include "Core/NamiCameraMath.h"
+#include "Core/NamiCameraView.h"
+#include "Misc/StringBuilder.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(NamiCameraState)
 
@@ -61,11 +63,6 @@ void FNamiCameraState::ComputeOutput()
 	NAMI_LOG_STATE(VeryVerbose, TEXT("[FNamiCameraState::ComputeOutput] 吊臂旋转: ArmRotation=%s, RotatedCameraOffset=%s, CameraLocation=%s"),
 		*ArmRotation.ToString(), *RotatedCameraOffset.ToString(), *CameraLocation.ToString());
 	
-	// 记录最终相机位置计算（用于验证 Additive vs Override 差异）
-	// 使用 Warning 级别，确保能看到最终位置（用于调试 Additive vs Override）
-	NAMI_LOG_WARNING(TEXT("[ComputeOutput] ★ 最终相机位置: PivotLocation=%s, ArmRotation=%s, RotatedOffset=%s, FinalLocation=%s"),
-		*PivotLocation.ToString(), *ArmRotation.ToString(), *RotatedCameraOffset.ToString(), *CameraLocation.ToString());
-	
 	// ========== 第四步：应用吊臂末端偏移（吊臂本地空间）==========
 	// 吊臂末端的实际旋转 = BasePivot + ArmRotation
 	const FQuat FinalArmQuat = BasePivotQuat * ArmQuat;
@@ -100,25 +97,46 @@ void FNamiCameraState::ComputeOutput()
 		*CameraLocation.ToString(), *CameraRotation.ToString(), FieldOfView);
 }
 
+namespace NamiCameraState_Impl
+{
+	/** 将修改标记格式化为可读字符串（仅用于日志） */
+	static FString DescribeChangedFlags(const FNamiCameraStateFlags& Flags)
+	{
+		TStringBuilder<256> Builder;
+		auto Append = [&Builder](bool bChanged, const TCHAR* Name)
+		{
+			if (bChanged)
+			{
+				if (Builder.Len() > 0)
+				{
+					Builder.Append(TEXT(", "));
+				}
+				Builder.Append(Name);
+			}
+		};
+
+		Append(Flags.bPivotLocation, TEXT("PivotLocation"));
+		Append(Flags.bPivotRotation, TEXT("PivotRotation"));
+		Append(Flags.bArmLength, TEXT("ArmLength"));
+		Append(Flags.bArmRotation, TEXT("ArmRotation"));
+		Append(Flags.bArmOffset, TEXT("ArmOffset"));
+		Append(Flags.bCameraLocationOffset, TEXT("CameraLocationOffset"));
+		Append(Flags.bCameraRotationOffset, TEXT("CameraRotationOffset"));
+		Append(Flags.bFieldOfView, TEXT("FieldOfView"));
+		Append(Flags.bCameraLocation, TEXT("CameraLocation"));
+		Append(Flags.bCameraRotation, TEXT("CameraRotation"));
+
+		return Builder.Len() > 0 ? FString(Builder.ToView()) : FString(TEXT("无"));
+	}
+}
+
 void FNamiCameraState::ApplyChanged(const FNamiCameraState& Other, ENamiCameraBlendMode BlendMode, float Weight)
 {
 	const FNamiCameraStateFlags& OtherFlags = Other.ChangedFlags;
 	
-	// 记录被修改的参数
-	TArray<FString> ChangedParams;
-	if (OtherFlags.bPivotLocation) ChangedParams.Add(TEXT("PivotLocation"));
-	if (OtherFlags.bPivotRotation) ChangedParams.Add(TEXT("PivotRotation"));
-	if (OtherFlags.bArmLength) ChangedParams.Add(TEXT("ArmLength"));
-	if (OtherFlags.bArmRotation) ChangedParams.Add(TEXT("ArmRotation"));
-	if (OtherFlags.bArmOffset) ChangedParams.Add(TEXT("ArmOffset"));
-	if (OtherFlags.bCameraLocationOffset) ChangedParams.Add(TEXT("CameraLocationOffset"));
-	if (OtherFlags.bCameraRotationOffset) ChangedParams.Add(TEXT("CameraRotationOffset"));
-	if (OtherFlags.bFieldOfView) ChangedParams.Add(TEXT("FieldOfView"));
-	if (OtherFlags.bCameraLocation) ChangedParams.Add(TEXT("CameraLocation"));
-	if (OtherFlags.bCameraRotation) ChangedParams.Add(TEXT("CameraRotation"));
-	
+	// 被修改参数列表仅在日志开启时才拼接（宏内参数按需求值），避免每帧分配
 	NAMI_LOG_STATE(Verbose, TEXT("[FNamiCameraState::ApplyChanged] 开始混合: BlendMode=%d, Weight=%.3f, 修改参数: [%s]"),
-		(int32)BlendMode, Weight, ChangedParams.Num() > 0 ? *FString::Join(ChangedParams, TEXT(", ")) : TEXT("无"));
+		(int32)BlendMode, Weight, *NamiCameraState_Impl::DescribeChangedFlags(OtherFlags));
 	
 	// 应用输入参数
 	if (OtherFlags.bPivotLocation)
@@ -227,9 +245,6 @@ void FNamiCameraState::ApplyChanged(const FNamiCameraState& Other, ENamiCameraBl
 				ArmRotation.Yaw = NormalizedCurrent.Yaw + YawDelta;
 				ArmRotation.Roll = NormalizedCurrent.Roll + RollDelta;
 			}
-			// 使用 Warning 级别，确保能看到混合过程（用于调试 Additive vs Override）
-			NAMI_LOG_WARNING(TEXT("[ApplyChanged] ★ ArmRotation Additive: 当前值=%s + 目标值=%s * 权重=%.3f = 结果=%s"),
-				*OldArmRotation.ToString(), *TargetArmRotation.ToString(), Weight, *ArmRotation.ToString());
 			break;
 		case ENamiCameraBlendMode::Override:
 			// Override: 从当前值过渡到目标值（覆盖）
@@ -244,9 +259,6 @@ void FNamiCameraState::ApplyChanged(const FNamiCameraState& Other, ENamiCameraBl
 				ArmRotation.Yaw = NormalizedCurrent.Yaw + YawDelta * Weight;
 				ArmRotation.Roll = NormalizedCurrent.Roll + RollDelta * Weight;
 			}
-			// 使用 Warning 级别，确保能看到混合过程（用于调试 Additive vs Override）
-			NAMI_LOG_WARNING(TEXT("[ApplyChanged] ★ ArmRotation Override: Lerp(当前值=%s, 目标值=%s, 权重=%.3f) = 结果=%s"),
-				*OldArmRotation.ToString(), *TargetArmRotation.ToString(), Weight, *ArmRotation.ToString());
 			break;
 		}
 		// 确保结果在0-360度范围（只归一化一次）
@@ -461,6 +473,29 @@ void FNamiCameraState::LerpChanged(const FNamiCameraState& To, float Alpha, cons
 	}
 }
 
+void FNamiCameraState::SetFromView(const FNamiCameraView& View)
+{
+	const FVector Arm = View.CameraLocation - View.PivotLocation;
+	const double ArmSize = Arm.Size();
+
+	// 相机位于枢轴点后方：PivotRotation 的前向指向枢轴点；吊臂退化时直接取相机朝向
+	const FRotator ArmDirection = ArmSize > KINDA_SMALL_NUMBER ? (-Arm).Rotation() : View.CameraRotation;
+
+	PivotLocation = View.PivotLocation;
+	PivotRotation = ArmDirection;
+	ArmLength = static_cast<float>(ArmSize);
+	ArmRotation = FRotator::ZeroRotator;
+	ArmOffset = FVector::ZeroVector;
+	CameraLocationOffset = FVector::ZeroVector;
+	CameraRotationOffset = (View.CameraRotation - ArmDirection).GetNormalized();
+	FieldOfView = FMath::Clamp(View.FOV, 5.0f, 170.0f);
+	CameraLocation = View.CameraLocation;
+	CameraRotation = View.CameraRotation;
+
+	ChangedFlags.SetAllInput(true);
+	ChangedFlags.SetAllOutput(false);
+}
+
 void FNamiCameraState::Reset()
 {
 	// 枢轴点参数
@@ -1,6 +1,8 @@
 // Copyright Qiu, Inc. All Rights Reserved.
 
 #include "Core/NamiCameraStats.h"
+#include "Core/LogNamiCamera.h"
+#include "HAL/IConsoleManager.h"
 
 /**
  * NamiCamera 性能统计实现
@@ -18,3 +20,107 @@ DEFINE_STAT(STAT_NamiCamera_ModeStack);
 DEFINE_STAT(STAT_NamiCamera_CameraAdjust);
 DEFINE_STAT(STAT_NamiCamera_ModeComponents);
 DEFINE_STAT(STAT_NamiCamera_Smoothing);
+DEFINE_STAT(STAT_NamiCamera_PreProcess);
+DEFINE_STAT(STAT_NamiCamera_ControllerSync);
+DEFINE_STAT(STAT_NamiCamera_PostProcess);
+DEFINE_STAT(STAT_NamiCamera_ModeTick);
+DEFINE_STAT(STAT_NamiCamera_Calculators);
+DEFINE_STAT(STAT_NamiCamera_Sweeps);
+DEFINE_STAT(STAT_NamiCamera_LineTraces);
+DEFINE_STAT(STAT_NamiCamera_DeferredQueries);
+DEFINE_STAT(STAT_NamiCamera_SkippedModeTicks);
+DEFINE_STAT(STAT_NamiCamera_ReusedModeViews);
+DEFINE_STAT(STAT_NamiCamera_CollapsedModes);
+DEFINE_STAT(STAT_NamiCamera_ModeStackCollapses);
+
+// ============================================================================
+// 分配审计
+// ============================================================================
+
+uint64 FNamiCameraAllocAudit::GetAllocationCallCount()
+{
+#if !UE_BUILD_SHIPPING
+	return static_cast<uint64>(FMalloc::TotalMallocCalls) + static_cast<uint64>(FMalloc::TotalReallocCalls);
+#else
+	return 0;
+#endif
+}
+
+#if NAMICAMERA_WITH_ALLOC_AUDIT
+
+namespace NamiCameraAllocAudit_Impl
+{
+	static int32 GAllocAuditEnabled = 0;
+	static FAutoConsoleVariableRef CVarAllocAudit(
+		TEXT("NamiCamera.AllocAudit"),
+		GAllocAuditEnabled,
+		TEXT("统计 GetCameraView 各阶段的堆分配次数，发生分配的帧输出警告。0=关闭，1=开启"),
+		ECVF_Cheat);
+
+	/** 单帧阶段记录（仅游戏线程使用，固定容量避免审计本身分配） */
+	struct FStageRecord
+	{
+		const TCHAR* StageName = nullptr;
+		uint64 Allocs = 0;
+	};
+
+	static constexpr int32 MaxStageRecords = 16;
+	static FStageRecord GStageRecords[MaxStageRecords];
+	static int32 GNumStageRecords = 0;
+}
+
+bool FNamiCameraAllocAudit::IsEnabled()
+{
+	return NamiCameraAllocAudit_Impl::GAllocAuditEnabled != 0 && IsInGameThread();
+}
+
+void FNamiCameraAllocAudit::BeginFrame()
+{
+	NamiCameraAllocAudit_Impl::GNumStageRecords = 0;
+}
+
+void FNamiCameraAllocAudit::RecordStage(const TCHAR* StageName, uint64 StageAllocs)
+{
+	using namespace NamiCameraAllocAudit_Impl;
+
+	// 同名阶段（如多个模式各自的 ModeTick）累加到同一条记录
+	for (int32 Index = 0; Index < GNumStageRecords; ++Index)
+	{
+		if (GStageRecords[Index].StageName == StageName || FCString::Strcmp(GStageRecords[Index].StageName, StageName) == 0)
+		{
+			GStageRecords[Index].Allocs += StageAllocs;
+			return;
+		}
+	}
+
+	if (GNumStageRecords < MaxStageRecords)
+	{
+		GStageRecords[GNumStageRecords].StageName = StageName;
+		GStageRecords[GNumStageRecords].Allocs = StageAllocs;
+		++GNumStageRecords;
+	}
+}
+
+void FNamiCameraAllocAudit::EndFrame(const UObject* Context, uint64 FrameAllocs)
+{
+	using namespace NamiCameraAllocAudit_Impl;
+
+	if (FrameAllocs == 0)
+	{
+		return;
+	}
+
+	FString Breakdown;
+	for (int32 Index = 0; Index < GNumStageRecords; ++Index)
+	{
+		if (GStageRecords[Index].Allocs > 0)
+		{
+			Breakdown += FString::Printf(TEXT(" %s=%llu"), GStageRecords[Index].StageName, GStageRecords[Index].Allocs);
+		}
+	}
+
+	UE_LOG(LogNamiCamera, Warning, TEXT("[AllocAudit] %s allocated %llu times this frame:%s"),
+		*GetNameSafe(Context), FrameAllocs, *Breakdown);
+}
+
+#endif // NAMICAMERA_WITH_ALLOC_AUDIT
@@ -0,0 +1,235 @@
+// Copyright Qiu, Inc. All Rights Reserved.
+
+#include "Debug/GameplayDebuggerCategory_NamiCamera.h"
+
+#if WITH_GAMEPLAY_DEBUGGER
+
+#include "Adjustments/NamiCameraAdjust.h"
+#include "CameraModes/NamiCameraModeBase.h"
+#include "Components/NamiCameraComponent.h"
+#include "Core/NamiCameraFlightRecorder.h"
+#include "Core/NamiCameraSceneQueryBroker.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "ModeComponents/NamiCameraModeComponent.h"
+
+namespace NamiCameraDebugger_Impl
+{
+	static constexpr int32 NumStages = static_cast<int32>(ENamiCameraFlightStage::Count);
+
+	static const TCHAR* StageNames[NumStages] =
+	{
+		TEXT("PreProcess"),
+		TEXT("ModeStack"),
+		TEXT("CameraAdjust"),
+		TEXT("ControllerSync"),
+		TEXT("Smoothing"),
+		TEXT("PostProcess"),
+	};
+
+	static const TCHAR* GetAdjustStateName(ENamiCameraAdjustState State)
+	{
+		switch (State)
+		{
+		case ENamiCameraAdjustState::Inactive:    return TEXT("Inactive");
+		case ENamiCameraAdjustState::BlendingIn:  return TEXT("BlendingIn");
+		case ENamiCameraAdjustState::Active:      return TEXT("Active");
+		case ENamiCameraAdjustState::BlendingOut: return TEXT("BlendingOut");
+		default:                                  return TEXT("Unknown");
+		}
+	}
+}
+
+FGameplayDebuggerCategory_NamiCamera::FGameplayDebuggerCategory_NamiCamera()
+{
+	bShowOnlyWithDebugActor = false;
+	bAllowLocalDataCollection = true;
+	SetDataPackReplication<FRepData>(&DataPack);
+}
+
+TSharedRef<FGameplayDebuggerCategory> FGameplayDebuggerCategory_NamiCamera::MakeInstance()
+{
+	return MakeShareable(new FGameplayDebuggerCategory_NamiCamera());
+}
+
+UNamiCameraComponent* FGameplayDebuggerCategory_NamiCamera::FindCameraComponent(APlayerController* OwnerPC, AActor* DebugActor)
+{
+	if (DebugActor)
+	{
+		if (UNamiCameraComponent* CameraComponent = DebugActor->FindComponentByClass<UNamiCameraComponent>())
+		{
+			return CameraComponent;
+		}
+	}
+
+	if (OwnerPC)
+	{
+		if (APawn* Pawn = OwnerPC->GetPawn())
+		{
+			if (UNamiCameraComponent* CameraComponent = Pawn->FindComponentByClass<UNamiCameraComponent>())
+			{
+				return CameraComponent;
+			}
+		}
+
+		if (AActor* ViewTarget = OwnerPC->GetViewTarget())
+		{
+			return ViewTarget->FindComponentByClass<UNamiCameraComponent>();
+		}
+	}
+
+	return nullptr;
+}
+
+void FGameplayDebuggerCategory_NamiCamera::CollectData(APlayerController* OwnerPC, AActor* DebugActor)
+{
+	using namespace NamiCameraDebugger_Impl;
+
+	// 只在本地玩家端收集：服务器上的相机组件不被本地玩家驱动，数据过期；此时保留数据包不变，不覆盖客户端的本地数据
+	if (!OwnerPC || !OwnerPC->IsLocalController())
+	{
+		return;
+	}
+
+	DataPack = FRepData();
+
+	const UNamiCameraComponent* CameraComponent = FindCameraComponent(OwnerPC, DebugActor);
+	if (!CameraComponent)
+	{
+		return;
+	}
+
+	DataPack.OwnerName = GetNameSafe(CameraComponent->GetOwner());
+
+	// 优先级堆栈
+	for (const FNamiCameraModeStackEntry& Entry : CameraComponent->GetCameraModePriorityStack())
+	{
+		DataPack.PriorityStack.Add(FString::Printf(TEXT("%s  Priority=%d  Handle=%d"),
+			*GetNameSafe(Entry.CameraMode.Get()), Entry.Priority, Entry.HandleId));
+	}
+
+	// 混合堆栈
+	const TArray<TObjectPtr<UNamiCameraModeBase>>& BlendModes = CameraComponent->GetBlendingStack().GetCameraModes();
+	for (const UNamiCameraModeBase* CameraMode : BlendModes)
+	{
+		DataPack.BlendModeNames.Add(GetNameSafe(CameraMode));
+		DataPack.BlendWeights.Add(CameraMode ? CameraMode->GetBlendWeight() : 0.0f);
+	}
+
+	// 栈顶模式的启用组件
+	if (BlendModes.Num() > 0 && BlendModes[0])
+	{
+		for (const UNamiCameraModeComponent* ModeComponent : BlendModes[0]->GetComponents())
+		{
+			if (ModeComponent && ModeComponent->IsEnabled())
+			{
+				DataPack.ModeComponents.Add(FString::Printf(TEXT("%s (%s)  Priority=%d"),
+					*ModeComponent->ComponentName.ToString(), *ModeComponent->GetClass()->GetName(), ModeComponent->Priority));
+			}
+		}
+	}
+
+	// 调整器
+	for (const UNamiCameraAdjust* Adjust : CameraComponent->GetAdjusts())
+	{
+		if (IsValid(Adjust))
+		{
+			DataPack.AdjustNames.Add(Adjust->GetClass()->GetName());
+			DataPack.AdjustStates.Add(GetAdjustStateName(Adjust->GetState()));
+			DataPack.AdjustWeights.Add(Adjust->GetCurrentBlendWeight());
+		}
+	}
+	for (const FNamiCameraAdjustLayer& Layer : CameraComponent->GetAdjustLayers())
+	{
+		DataPack.AdjustNames.Add(FString::Printf(TEXT("Layer#%d"), Layer.GetId()));
+		DataPack.AdjustStates.Add(GetAdjustStateName(Layer.GetState()));
+		DataPack.AdjustWeights.Add(Layer.GetCurrentBlendWeight());
+	}
+
+	// 成本
+	const FNamiCameraFlightRecorder& FlightRecorder = CameraComponent->GetFlightRecorder();
+	const TConstArrayView<float> StageMs = FlightRecorder.GetLastStageMs();
+	DataPack.StageMs.Append(StageMs.GetData(), StageMs.Num());
+	DataPack.TotalMs = FlightRecorder.GetLastTotalMs();
+	const FNamiCameraSceneQueryBroker& QueryBroker = CameraComponent->GetSceneQueryBroker();
+	DataPack.NumSweeps = QueryBroker.GetLastFrameSweeps();
+	DataPack.NumLineTraces = QueryBroker.GetLastFrameLineTraces();
+	DataPack.NumDeferredQueries = QueryBroker.GetLastFrameDeferred();
+	DataPack.DegradeLevel = static_cast<uint8>(CameraComponent->GetDegradeLevel());
+}
+
+void FGameplayDebuggerCategory_NamiCamera::DrawData(APlayerController* OwnerPC, FGameplayDebuggerCanvasContext& CanvasContext)
+{
+	using namespace NamiCameraDebugger_Impl;
+
+	if (DataPack.OwnerName.IsEmpty())
+	{
+		CanvasContext.Print(TEXT("{red}No NamiCameraComponent found"));
+		return;
+	}
+
+	CanvasContext.Printf(TEXT("Owner: {yellow}%s"), *DataPack.OwnerName);
+
+	// 成本
+	CanvasContext.Printf(TEXT("{white}Frame: {yellow}%.3f ms{white}  Sweeps: {yellow}%d{white}  Traces: {yellow}%d{white}  Deferred: {yellow}%d{white}  Degrade: %s%d"),
+		DataPack.TotalMs, DataPack.NumSweeps, DataPack.NumLineTraces, DataPack.NumDeferredQueries,
+		DataPack.DegradeLevel > 0 ? TEXT("{red}") : TEXT("{green}"), DataPack.DegradeLevel);
+	FString StageLine;
+	for (int32 Stage = 0; Stage < DataPack.StageMs.Num() && Stage < NumStages; ++Stage)
+	{
+		StageLine += FString::Printf(TEXT("%s=%.3f  "), StageNames[Stage], DataPack.StageMs[Stage]);
+	}
+	CanvasContext.Printf(TEXT("{grey}%s"), *StageLine);
+
+	// 优先级堆栈
+	CanvasContext.Printf(TEXT("{white}Priority Stack (%d):"), DataPack.PriorityStack.Num());
+	for (const FString& Line : DataPack.PriorityStack)
+	{
+		CanvasContext.Printf(TEXT("  {cyan}%s"), *Line);
+	}
+
+	// 混合堆栈
+	CanvasContext.Printf(TEXT("{white}Blending Stack (%d):"), DataPack.BlendModeNames.Num());
+	for (int32 Index = 0; Index < DataPack.BlendModeNames.Num(); ++Index)
+	{
+		const float Weight = DataPack.BlendWeights.IsValidIndex(Index) ? DataPack.BlendWeights[Index] : 0.0f;
+		CanvasContext.Printf(TEXT("  [%d] {cyan}%s{white}  Weight: {yellow}%.3f"), Index, *DataPack.BlendModeNames[Index], Weight);
+	}
+
+	// 模式组件
+	CanvasContext.Printf(TEXT("{white}Mode Components (%d):"), DataPack.ModeComponents.Num());
+	for (const FString& Line : DataPack.ModeComponents)
+	{
+		CanvasContext.Printf(TEXT("  {green}%s"), *Line);
+	}
+
+	// 调整器
+	CanvasContext.Printf(TEXT("{white}Adjusts (%d):"), DataPack.AdjustNames.Num());
+	for (int32 Index = 0; Index < DataPack.AdjustNames.Num(); ++Index)
+	{
+		CanvasContext.Printf(TEXT("  {cyan}%s{white}  %s  Weight: {yellow}%.3f"),
+			*DataPack.AdjustNames[Index],
+			DataPack.AdjustStates.IsValidIndex(Index) ? *DataPack.AdjustStates[Index] : TEXT(""),
+			DataPack.AdjustWeights.IsValidIndex(Index) ? DataPack.AdjustWeights[Index] : 0.0f);
+	}
+}
+
+void FGameplayDebuggerCategory_NamiCamera::FRepData::Serialize(FArchive& Ar)
+{
+	Ar << OwnerName;
+	Ar << PriorityStack;
+	Ar << BlendModeNames;
+	Ar << BlendWeights;
+	Ar << AdjustNames;
+	Ar << AdjustStates;
+	Ar << AdjustWeights;
+	Ar << ModeComponents;
+	Ar << StageMs;
+	Ar << TotalMs;
+	Ar << NumSweeps;
+	Ar << NumLineTraces;
+	Ar << NumDeferredQueries;
+	Ar << DegradeLevel;
+}
+
+#endif // WITH_GAMEPLAY_DEBUGGER
@@ -0,0 +1,75 @@
+// Copyright Qiu, Inc. All Rights Reserved.
+
+#pragma once
+
+#if WITH_GAMEPLAY_DEBUGGER
+
+#include "CoreMinimal.h"
+#include "GameplayDebuggerCategory.h"
+
+class AActor;
+class APlayerController;
+class UNamiCameraComponent;
+
+/**
+ * NamiCamera GameplayDebugger 分类
+ *
+ * 显示优先级堆栈、混合堆栈权重、激活的调整器及其混合状态、启用的模式组件、
+ * 最近一帧各阶段耗时与场景查询次数（含被预算推迟的查询）。
+ * 相机只在本地玩家端逐帧评估，数据在本地客户端收集（bAllowLocalDataCollection）；
+ * 服务器上的组件不由本地玩家驱动，其数据是过期的，OwnerPC 不是本地控制器时不收集。仅在分类打开时产生开销。
+ * 优先读取调试目标 Actor 上的相机组件，未选择目标时读取本地玩家 Pawn / ViewTarget 上的相机组件。
+ */
+class FGameplayDebuggerCategory_NamiCamera : public FGameplayDebuggerCategory
+{
+public:
+	FGameplayDebuggerCategory_NamiCamera();
+
+	virtual void CollectData(APlayerController* OwnerPC, AActor* DebugActor) override;
+	virtual void DrawData(APlayerController* OwnerPC, FGameplayDebuggerCanvasContext& CanvasContext) override;
+
+	static TSharedRef<FGameplayDebuggerCategory> MakeInstance();
+
+protected:
+	/** 查找要显示的相机组件 */
+	static UNamiCameraComponent* FindCameraComponent(APlayerController* OwnerPC, AActor* DebugActor);
+
+	struct FRepData
+	{
+		/** 相机组件所属 Actor */
+		FString OwnerName;
+
+		/** 优先级堆栈（每项一行） */
+		TArray<FString> PriorityStack;
+
+		/** 混合堆栈（模式名与权重，索引 0 为栈顶） */
+		TArray<FString> BlendModeNames;
+		TArray<float> BlendWeights;
+
+		/** 激活的调整器（名称、状态、权重） */
+		TArray<FString> AdjustNames;
+		TArray<FString> AdjustStates;
+		TArray<float> AdjustWeights;
+
+		/** 栈顶模式中启用的模式组件 */
+		TArray<FString> ModeComponents;
+
+		/** 最近一帧阶段耗时（毫秒），按 ENamiCameraFlightStage 索引 */
+		TArray<float> StageMs;
+		float TotalMs = 0.0f;
+
+		/** 最近一帧场景查询次数（扫掠/射线/被推迟） */
+		int32 NumSweeps = 0;
+		int32 NumLineTraces = 0;
+		int32 NumDeferredQueries = 0;
+
+		/** 帧预算降级等级（ENamiCameraDegradeLevel） */
+		uint8 DegradeLevel = 0;
+
+		void Serialize(FArchive& Ar);
+	};
+
+	FRepData DataPack;
+};
+
+#endif // WITH_GAMEPLAY_DEBUGGER
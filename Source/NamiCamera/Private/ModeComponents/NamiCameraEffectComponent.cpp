@@ -3,6 +3,7 @@
 #include "ModeComponents/NamiCameraEffectComponent.h"
 #include "Core/LogNamiCamera.h"
 #include "Core/LogNamiCameraMacros.h"
+#include "Core/NamiCameraEasing.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(NamiCameraEffectComponent)
 
@@ -165,11 +166,11 @@ float UNamiCameraEffectComponent::CalculateBlendWeight(float DeltaTime)
 			// 应用缓动函数到 BlendAlpha
 			if (BlendCurve)
 			{
-				BlendAlpha = BlendCurve->GetFloatValue(BlendAlpha);
+				BlendAlpha = BlendCurveLUT.Evaluate(BlendCurve, BlendAlpha);
 			}
 			else
 			{
-				BlendAlpha = FMath::InterpEaseInOut(0.0f, 1.0f, BlendAlpha, 2.0f);
+				BlendAlpha = FNamiCameraEasing::EaseInOut(BlendAlpha);
 			}
 
 			// 权重从 BlendOutStartWeight 降到 0.0
@@ -191,11 +192,11 @@ float UNamiCameraEffectComponent::CalculateBlendWeight(float DeltaTime)
 			// 应用缓动函数
 			if (BlendCurve)
 			{
-				Weight = BlendCurve->GetFloatValue(BlendAlpha);
+				Weight = BlendCurveLUT.Evaluate(BlendCurve, BlendAlpha);
 			}
 			else
 			{
-				Weight = FMath::InterpEaseInOut(0.0f, 1.0f, BlendAlpha, 2.0f);
+				Weight = FNamiCameraEasing::EaseInOut(BlendAlpha);
 			}
 		}
 	}
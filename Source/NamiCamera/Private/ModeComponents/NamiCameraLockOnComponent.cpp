@@ -49,6 +49,15 @@ void UNamiCameraLockOnComponent::Update_Implementation(float DeltaTime)
 	}
 }
 
+bool UNamiCameraLockOnComponent::IsSettled_Implementation() const
+{
+	if (!HasValidLockedTarget())
+	{
+		return true;
+	}
+	return bTargetLocationInitialized && SmoothedTargetLocation.Equals(GetLockedFocusLocation(), 0.01);
+}
+
 void UNamiCameraLockOnComponent::SetLockOnProvider(TScriptInterface<INamiLockOnTargetProvider> Provider)
 {
 	LockOnProvider = Provider;
@@ -2,7 +2,9 @@
 
 #include "ModeComponents/NamiCameraModeComponent.h"
 #include "CameraModes/NamiCameraModeBase.h"
+#include "Components/NamiCameraComponent.h"
 #include "Core/NamiCameraPipelineContext.h"
+#include "Engine/World.h"
 
 UNamiCameraModeComponent::UNamiCameraModeComponent()
 	: Priority(0)
@@ -40,6 +42,12 @@ void UNamiCameraModeComponent::ApplyToViewWithContext_Implementation(
 	ApplyToView(InOutView, DeltaTime);
 }
 
+bool UNamiCameraModeComponent::IsSettled_Implementation() const
+{
+	// 默认视为无状态组件：收敛与否由模式对比前后两次输出判断
+	return true;
+}
+
 UWorld* UNamiCameraModeComponent::GetWorld() const
 {
 	if (CameraMode.IsValid())
@@ -48,3 +56,25 @@ UWorld* UNamiCameraModeComponent::GetWorld() const
 	}
 	return nullptr;
 }
+
+FNamiCameraSceneQueryBroker* UNamiCameraModeComponent::GetSceneQueryBroker() const
+{
+	UNamiCameraComponent* CameraComponent = CameraMode.IsValid() ? CameraMode->GetCameraComponent() : nullptr;
+	return CameraComponent ? &CameraComponent->GetSceneQueryBroker() : nullptr;
+}
+
+bool UNamiCameraModeComponent::IsCameraDegraded(ENamiCameraDegradeLevel Level) const
+{
+	UNamiCameraComponent* CameraComponent = CameraMode.IsValid() ? CameraMode->GetCameraComponent() : nullptr;
+	return CameraComponent && CameraComponent->GetDegradeLevel() >= Level;
+}
+
+double UNamiCameraModeComponent::GetCameraTimeSeconds() const
+{
+	if (const UNamiCameraComponent* CameraComponent = CameraMode.IsValid() ? CameraMode->GetCameraComponent() : nullptr)
+	{
+		return CameraComponent->GetCameraTimeSeconds();
+	}
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0.0;
+}
@@ -26,6 +26,15 @@ void UNamiCameraSpringArmComponent::Initialize_Implementation(UNamiCameraModeBas
 {
 	Super::Initialize_Implementation(InCameraMode);
 
+	// 蓝图重写无法在原生路径中生效；C++ 子类可能重写 GetIgnoreActors_Implementation，反射无法区分，同样走事件路径
+	const UClass* NativeClass = GetClass();
+	while (NativeClass && !NativeClass->HasAnyClassFlags(CLASS_Native))
+	{
+		NativeClass = NativeClass->GetSuperClass();
+	}
+	bUseIgnoreActorsEvent = NativeClass != UNamiCameraSpringArmComponent::StaticClass()
+		|| GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UNamiCameraSpringArmComponent, GetIgnoreActors));
+
 	SpringArm.Initialize();
 	bSpringArmInitialized = true;
 }
@@ -53,11 +62,21 @@ void UNamiCameraSpringArmComponent::ApplyToView_Implementation(FNamiCameraView&
 	InitialTransform.SetLocation(InOutView.PivotLocation);
 	InitialTransform.SetRotation(InOutView.CameraRotation.Quaternion());
 
-	// 收集忽略 Actor
-	TArray<AActor*> IgnoreActors = GetIgnoreActors();
+	// 收集忽略 Actor（未被重写时复用缓冲，避免每帧分配）
+	if (bUseIgnoreActorsEvent)
+	{
+		IgnoreActorsBuffer = GetIgnoreActors();
+	}
+	else
+	{
+		CollectIgnoreActors(IgnoreActorsBuffer);
+	}
 
-	// 执行 SpringArm 计算
-	SpringArm.Tick(this, DeltaTime, IgnoreActors, InitialTransform, FVector::ZeroVector);
+	// 执行 SpringArm 计算（碰撞扫掠经由相机组件的场景查询代理）
+	SpringArm.QueryBroker = GetSceneQueryBroker();
+	SpringArm.bReuseLastProbe = IsCameraDegraded(ENamiCameraDegradeLevel::ReuseCollision);
+	SpringArm.TimeSecondsOverride = GetCameraTimeSeconds();
+	SpringArm.Tick(this, DeltaTime, IgnoreActorsBuffer, InitialTransform, FVector::ZeroVector);
 
 	// 获取结果并更新 View
 	const FTransform& CameraTransform = SpringArm.GetCameraTransform();
@@ -68,6 +87,13 @@ void UNamiCameraSpringArmComponent::ApplyToView_Implementation(FNamiCameraView&
 TArray<AActor*> UNamiCameraSpringArmComponent::GetIgnoreActors_Implementation() const
 {
 	TArray<AActor*> IgnoreActors;
+	CollectIgnoreActors(IgnoreActors);
+	return IgnoreActors;
+}
+
+void UNamiCameraSpringArmComponent::CollectIgnoreActors(TArray<AActor*>& OutIgnoreActors) const
+{
+	OutIgnoreActors.Reset();
 
 	if (UNamiCameraModeBase* Mode = GetCameraMode())
 	{
@@ -75,10 +101,8 @@ TArray<AActor*> UNamiCameraSpringArmComponent::GetIgnoreActors_Implementation()
 		{
 			if (AActor* Owner = CameraComp->GetOwner())
 			{
-				IgnoreActors.Add(Owner);
+				OutIgnoreActors.Add(Owner);
 			}
 		}
 	}
-
-	return IgnoreActors;
 }
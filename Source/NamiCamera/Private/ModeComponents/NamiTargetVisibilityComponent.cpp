@@ -2,6 +2,7 @@
 
 #include "ModeComponents/NamiTargetVisibilityComponent.h"
 #include "CameraModes/NamiCameraModeBase.h"
+#include "Core/NamiCameraSceneQueryBroker.h"
 #include "Engine/World.h"
 #include "GameFramework/PlayerController.h"
 
@@ -60,14 +61,18 @@ void UNamiTargetVisibilityComponent::Update_Implementation(float DeltaTime)
 	const FVector CameraLocation = Mode->GetLastCameraLocation();
 	const FVector TargetLocation = LockOnProvider->GetLockedLocation();
 
-	// 遮挡检测（按间隔执行）
-	if (VisibilityConfig.bEnableOcclusionCheck)
+	// 遮挡检测（按间隔执行；帧预算降级时跳过，沿用上次结果）
+	if (VisibilityConfig.bEnableOcclusionCheck && !IsCameraDegraded(ENamiCameraDegradeLevel::SkipOcclusion))
 	{
-		const float CurrentTime = World->GetTimeSeconds();
+		const float CurrentTime = static_cast<float>(GetCameraTimeSeconds());
 		if (CurrentTime - LastOcclusionCheckTime >= VisibilityConfig.OcclusionCheckInterval)
 		{
+			bOcclusionCheckDeferred = false;
 			PerformOcclusionCheck(CameraLocation, TargetLocation);
-			LastOcclusionCheckTime = CurrentTime;
+			if (!bOcclusionCheckDeferred)
+			{
+				LastOcclusionCheckTime = CurrentTime;
+			}
 		}
 	}
 
@@ -136,8 +141,8 @@ void UNamiTargetVisibilityComponent::PerformOcclusionCheck_Implementation(
 		return;
 	}
 
-	OccludedRayCount = 0;
 	const int32 TotalRays = VisibilityConfig.OcclusionRayCount;
+	FNamiCameraSceneQueryBroker* QueryBroker = GetSceneQueryBroker();
 
 	// 设置碰撞查询参数
 	FCollisionQueryParams QueryParams;
@@ -150,21 +155,34 @@ void UNamiTargetVisibilityComponent::PerformOcclusionCheck_Implementation(
 		QueryParams.AddIgnoredActor(Mode->GetOwnerActor());
 	}
 
+	// 遮挡射线可延迟：超出预算时推迟到下一帧
+	FHitResult HitResult;
+	auto TraceRay = [&](const FVector& EndPoint)
+	{
+		if (QueryBroker)
+		{
+			return QueryBroker->LineTraceSingleByChannel(World, HitResult, CameraLocation, EndPoint,
+				VisibilityConfig.OcclusionChannel, QueryParams, ENamiCameraSceneQueryPriority::Deferrable);
+		}
+		return World->LineTraceSingleByChannel(HitResult, CameraLocation, EndPoint, VisibilityConfig.OcclusionChannel, QueryParams)
+			? ENamiCameraSceneQueryResult::Hit
+			: ENamiCameraSceneQueryResult::Miss;
+	};
+
 	// 计算射线方向
 	const FVector Direction = (TargetLocation - CameraLocation).GetSafeNormal();
 
-	// 中心射线
-	FHitResult HitResult;
-	if (World->LineTraceSingleByChannel(
-		HitResult,
-		CameraLocation,
-		TargetLocation,
-		VisibilityConfig.OcclusionChannel,
-		QueryParams))
+	// 中心射线（被推迟时保留上次结果）
+	const ENamiCameraSceneQueryResult CenterResult = TraceRay(TargetLocation);
+	if (CenterResult == ENamiCameraSceneQueryResult::Deferred)
 	{
-		OccludedRayCount++;
+		bOcclusionCheckDeferred = true;
+		return;
 	}
 
+	OccludedRayCount = CenterResult == ENamiCameraSceneQueryResult::Hit ? 1 : 0;
+	int32 TracedRayCount = 1;
+
 	// 如果需要多条射线检测
 	if (TotalRays > 1)
 	{
@@ -188,20 +206,23 @@ void UNamiTargetVisibilityComponent::PerformOcclusionCheck_Implementation(
 
 			const FVector EndPoint = TargetLocation + Offset;
 
-			if (World->LineTraceSingleByChannel(
-				HitResult,
-				CameraLocation,
-				EndPoint,
-				VisibilityConfig.OcclusionChannel,
-				QueryParams))
+			const ENamiCameraSceneQueryResult RayResult = TraceRay(EndPoint);
+			if (RayResult == ENamiCameraSceneQueryResult::Deferred)
+			{
+				// 预算用尽，剩余射线本次不再发起
+				break;
+			}
+
+			++TracedRayCount;
+			if (RayResult == ENamiCameraSceneQueryResult::Hit)
 			{
 				OccludedRayCount++;
 			}
 		}
 	}
 
-	// 计算遮挡比例
-	CurrentOcclusionRatio = static_cast<float>(OccludedRayCount) / static_cast<float>(TotalRays);
+	// 计算遮挡比例（仅统计实际发起的射线）
+	CurrentOcclusionRatio = static_cast<float>(OccludedRayCount) / static_cast<float>(TracedRayCount);
 }
 
 bool UNamiTargetVisibilityComponent::PerformScreenBoundsCheck_Implementation(const FVector& TargetLocation)
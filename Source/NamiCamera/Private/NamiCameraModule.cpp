@@ -2,18 +2,48 @@
 
 #include "NamiCameraModule.h"
 #include "Modules/ModuleManager.h"
+#include "Core/NamiCameraLogFlags.h"
+#include "Core/NamiCameraCurveCache.h"
+
+#if WITH_GAMEPLAY_DEBUGGER
+#include "GameplayDebugger.h"
+#include "Debug/GameplayDebuggerCategory_NamiCamera.h"
+#endif
 
 #define LOCTEXT_NAMESPACE "FNamiCameraModule"
 
 void FNamiCameraModule::StartupModule()
 {
+	// 初始化日志开关缓存（设置 CDO 与控制台变量在此之后变化时会自行刷新）
+	FNamiCameraLogFlags::Refresh();
+
+	// 曲线查找表缓存（编辑器中监听曲线资源修改）
+	FNamiCameraCurveCache::Startup();
+
+#if WITH_GAMEPLAY_DEBUGGER
+	// 注册 GameplayDebugger 分类（默认关闭，在调试器中按数字键开启）
+	IGameplayDebugger& GameplayDebuggerModule = IGameplayDebugger::Get();
+	GameplayDebuggerModule.RegisterCategory(TEXT("NamiCamera"),
+		IGameplayDebugger::FOnGetCategory::CreateStatic(&FGameplayDebuggerCategory_NamiCamera::MakeInstance),
+		EGameplayDebuggerCategoryState::Disabled);
+	GameplayDebuggerModule.NotifyCategoriesChanged();
+#endif
 }
 
 void FNamiCameraModule::ShutdownModule()
 {
+	FNamiCameraCurveCache::Shutdown();
+
+#if WITH_GAMEPLAY_DEBUGGER
+	if (IGameplayDebugger::IsAvailable())
+	{
+		IGameplayDebugger& GameplayDebuggerModule = IGameplayDebugger::Get();
+		GameplayDebuggerModule.UnregisterCategory(TEXT("NamiCamera"));
+		GameplayDebuggerModule.NotifyCategoriesChanged();
+	}
+#endif
 }
 
 #undef LOCTEXT_NAMESPACE
 
 IMPLEMENT_MODULE(FNamiCameraModule, NamiCamera)
-
@@ -1,6 +1,7 @@
 ﻿// Copyright Qiu, Inc. All Rights Reserved.
 
 #include "Settings/NamiCameraSettings.h"
+#include "Core/NamiCameraLogFlags.h"
 
 const UNamiCameraSettings* UNamiCameraSettings::Get()
 {
@@ -14,54 +15,78 @@ UNamiCameraSettings::UNamiCameraSettings(const FObjectInitializer& ObjectInitial
 	SectionName = TEXT("NamiCamera");
 }
 
+void UNamiCameraSettings::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	if (HasAnyFlags(RF_ClassDefaultObject))
+	{
+		FNamiCameraLogFlags::Refresh(this);
+	}
+}
+
+void UNamiCameraSettings::PostReloadConfig(FProperty* PropertyThatWasLoaded)
+{
+	Super::PostReloadConfig(PropertyThatWasLoaded);
+
+	if (HasAnyFlags(RF_ClassDefaultObject))
+	{
+		FNamiCameraLogFlags::Refresh(this);
+	}
+}
+
+#if WITH_EDITOR
+void UNamiCameraSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	if (HasAnyFlags(RF_ClassDefaultObject))
+	{
+		FNamiCameraLogFlags::Refresh(this);
+	}
+}
+#endif
+
 bool UNamiCameraSettings::ShouldEnableStackDebugLog()
 {
-	const UNamiCameraSettings* Settings = Get();
-	return Settings && Settings->bEnableStackDebugLog;
+	return FNamiCameraLogFlags::IsSet(ENamiCameraLogFlag::StackDebug);
 }
 
 // ========== 日志开关检查方法 ==========
 
 bool UNamiCameraSettings::ShouldLogEffect()
 {
-	const UNamiCameraSettings* Settings = Get();
-	return Settings && Settings->bEnableEffectLog;
+	return FNamiCameraLogFlags::IsSet(ENamiCameraLogFlag::Effect);
 }
 
 bool UNamiCameraSettings::ShouldLogStateCalculation()
 {
-	const UNamiCameraSettings* Settings = Get();
-	return Settings && Settings->bEnableStateCalculationLog;
+	return FNamiCameraLogFlags::IsSet(ENamiCameraLogFlag::StateCalculation);
 }
 
 bool UNamiCameraSettings::ShouldLogComponent()
 {
-	const UNamiCameraSettings* Settings = Get();
-	return Settings && Settings->bEnableComponentLog;
+	return FNamiCameraLogFlags::IsSet(ENamiCameraLogFlag::Component);
 }
 
 bool UNamiCameraSettings::ShouldLogWarning()
 {
-	const UNamiCameraSettings* Settings = Get();
-	return Settings && Settings->bEnableWarningLog;
+	return FNamiCameraLogFlags::IsSet(ENamiCameraLogFlag::Warning);
 }
 
 bool UNamiCameraSettings::ShouldLogCameraInfo()
 {
-	const UNamiCameraSettings* Settings = Get();
-	return Settings && Settings->bEnableCameraInfoLog;
+	return FNamiCameraLogFlags::IsSet(ENamiCameraLogFlag::CameraInfo);
 }
 
 bool UNamiCameraSettings::ShouldLogModeBlend()
 {
-	const UNamiCameraSettings* Settings = Get();
-	return Settings && Settings->bEnableModeBlendLog;
+	return FNamiCameraLogFlags::IsSet(ENamiCameraLogFlag::ModeBlend);
 }
 
 bool UNamiCameraSettings::ShouldLogInputInterrupt()
 {
-	const UNamiCameraSettings* Settings = Get();
-	return Settings && Settings->bEnableInputInterruptLog;
+	return FNamiCameraLogFlags::IsSet(ENamiCameraLogFlag::InputInterrupt);
 }
 
 // ========== DrawDebug 检查方法 ==========
@@ -118,44 +143,37 @@ float UNamiCameraSettings::GetDrawDebugThickness()
 
 bool UNamiCameraSettings::ShouldLogEffectOnScreen()
 {
-	const UNamiCameraSettings* Settings = Get();
-	return Settings && Settings->bEnableEffectLogOnScreen;
+	return FNamiCameraLogFlags::IsSet(ENamiCameraLogFlag::EffectOnScreen);
 }
 
 bool UNamiCameraSettings::ShouldLogStateCalculationOnScreen()
 {
-	const UNamiCameraSettings* Settings = Get();
-	return Settings && Settings->bEnableStateCalculationLogOnScreen;
+	return FNamiCameraLogFlags::IsSet(ENamiCameraLogFlag::StateCalculationOnScreen);
 }
 
 bool UNamiCameraSettings::ShouldLogComponentOnScreen()
 {
-	const UNamiCameraSettings* Settings = Get();
-	return Settings && Settings->bEnableComponentLogOnScreen;
+	return FNamiCameraLogFlags::IsSet(ENamiCameraLogFlag::ComponentOnScreen);
 }
 
 bool UNamiCameraSettings::ShouldLogWarningOnScreen()
 {
-	const UNamiCameraSettings* Settings = Get();
-	return Settings && Settings->bEnableWarningLogOnScreen;
+	return FNamiCameraLogFlags::IsSet(ENamiCameraLogFlag::WarningOnScreen);
 }
 
 bool UNamiCameraSettings::ShouldLogCameraInfoOnScreen()
 {
-	const UNamiCameraSettings* Settings = Get();
-	return Settings && Settings->bEnableCameraInfoLogOnScreen;
+	return FNamiCameraLogFlags::IsSet(ENamiCameraLogFlag::CameraInfoOnScreen);
 }
 
 bool UNamiCameraSettings::ShouldLogModeBlendOnScreen()
 {
-	const UNamiCameraSettings* Settings = Get();
-	return Settings && Settings->bEnableModeBlendLogOnScreen;
+	return FNamiCameraLogFlags::IsSet(ENamiCameraLogFlag::ModeBlendOnScreen);
 }
 
 bool UNamiCameraSettings::ShouldLogInputInterruptOnScreen()
 {
-	const UNamiCameraSettings* Settings = Get();
-	return Settings && Settings->bEnableInputInterruptLogOnScreen;
+	return FNamiCameraLogFlags::IsSet(ENamiCameraLogFlag::InputInterruptOnScreen);
 }
 
 float UNamiCameraSettings::GetOnScreenLogDuration()
@@ -169,3 +187,10 @@ FLinearColor UNamiCameraSettings::GetOnScreenLogTextColor()
 	const UNamiCameraSettings* Settings = Get();
 	return Settings ? Settings->OnScreenLogTextColor : FLinearColor::Green;
 }
+
+const TArray<TSoftClassPtr<UNamiCameraModeBase>>& UNamiCameraSettings::GetPreloadCameraModes()
+{
+	static const TArray<TSoftClassPtr<UNamiCameraModeBase>> Empty;
+	const UNamiCameraSettings* Settings = Get();
+	return Settings ? Settings->PreloadCameraModes : Empty;
+}
@@ -12,6 +12,21 @@ class UNamiCameraComponent;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnCameraAdjustInputInterrupted);
 
+/**
+ * 调整器在相机组件堆栈中的排序键
+ * 推送时确定：推送时的优先级 + 推送序号，之后修改 Priority 不影响已在堆栈中的顺序
+ */
+struct FNamiCameraAdjustStackKey
+{
+	int32 Priority = 0;
+	int32 Sequence = 0;
+
+	bool operator<(const FNamiCameraAdjustStackKey& Other) const
+	{
+		return Priority != Other.Priority ? Priority < Other.Priority : Sequence < Other.Sequence;
+	}
+};
+
 UCLASS(Blueprintable, EditInlineNew, DefaultToInstanced)
 class NAMICAMERA_API UNamiCameraAdjust : public UObject
 {
@@ -22,6 +37,28 @@ public:
 
 	virtual void Initialize(UNamiCameraComponent* InOwnerComponent);
 
+	/**
+	 * 从调整器池取出复用前调用
+	 * 将可编辑/蓝图可见属性恢复为类默认值（同时清空委托绑定），清除静态参数与运行时状态，并递增池化序号。
+	 * 子类若有额外的非属性状态，应重写并调用 Super。
+	 */
+	virtual void ResetForReuse();
+
+	/** 池化序号，每次复用递增；通过 AcquireAdjust 取得实例的一方据此判断实例是否已被他人复用 */
+	UFUNCTION(BlueprintPure, Category = "Camera Adjust|Pool")
+	int32 GetPoolSerial() const { return static_cast<int32>(PoolSerial); }
+
+	/** 是否由 AcquireAdjust 取得（只有这类实例在移出堆栈后归还到池中） */
+	UFUNCTION(BlueprintPure, Category = "Camera Adjust|Pool")
+	bool IsPoolManaged() const { return bPoolManaged; }
+
+	/** 由 AcquireAdjust 标记 */
+	void MarkPoolManaged() { bPoolManaged = true; }
+
+	/** 推送时由相机组件分配的堆栈排序键 */
+	const FNamiCameraAdjustStackKey& GetStackKey() const { return StackKey; }
+	void SetStackKey(const FNamiCameraAdjustStackKey& InKey) { StackKey = InKey; }
+
 	UFUNCTION(BlueprintNativeEvent, Category = "Camera Adjust|Lifecycle")
 	void OnActivate();
 
@@ -34,7 +71,8 @@ public:
 	UFUNCTION(BlueprintNativeEvent, Category = "Camera Adjust")
 	FNamiCameraAdjustParams CalculateAdjustParams(float DeltaTime);
 
-	FNamiCameraAdjustParams GetWeightedAdjustParams(float DeltaTime);
+	/** 推进混合并返回按权重缩放的参数，曲线绑定读取组件本帧的输入快照 */
+	FNamiCameraAdjustParams GetWeightedAdjustParams(float DeltaTime, const FNamiCameraInputSnapshot& Inputs);
 
 	void RequestDeactivate(bool bForceImmediate = false);
 
@@ -144,15 +182,26 @@ protected:
 
 	FRotator CachedWorldArmRotationTarget;
 
+	/** BlendCurve 的共享查找表 */
+	FNamiCameraCurveLUTRef BlendCurveLUT;
+
 	void CacheArmRotationTarget();
 	void UpdateBlending(float DeltaTime);
 	float CalculateBlendAlpha(float LinearAlpha) const;
-	float GetInputSourceValue(ENamiCameraAdjustInputSource Source) const;
-	float EvaluateCurveBinding(const FNamiCameraAdjustCurveBinding& Binding) const;
-	void ApplyCurveDrivenParams(FNamiCameraAdjustParams& OutParams) const;
+	float EvaluateCurveBinding(const FNamiCameraAdjustCurveBinding& Binding, const FNamiCameraInputSnapshot& Inputs) const;
+	void ApplyCurveDrivenParams(FNamiCameraAdjustParams& OutParams, const FNamiCameraInputSnapshot& Inputs) const;
 
 	virtual void OnActivate_Implementation();
 	virtual void Tick_Implementation(float DeltaTime);
 	virtual void OnDeactivate_Implementation();
 	virtual FNamiCameraAdjustParams CalculateAdjustParams_Implementation(float DeltaTime);
+
+private:
+	uint32 PoolSerial = 0;
+	bool bPoolManaged = false;
+	FNamiCameraAdjustStackKey StackKey;
+
+	/** 类是否在蓝图中实现了 Tick / CalculateAdjustParams；未实现时直接调用原生实现，跳过 ProcessEvent */
+	bool bBlueprintTick = true;
+	bool bBlueprintCalculateParams = true;
 };
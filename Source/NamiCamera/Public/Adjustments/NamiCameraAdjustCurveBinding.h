@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "Curves/CurveFloat.h"
 #include "Core/NamiCameraEnums.h"
+#include "Core/NamiCameraCurveCache.h"
+#include "Core/NamiCameraInputSnapshot.h"
 #include "NamiCameraAdjustCurveBinding.generated.h"
 
 /**
@@ -18,6 +20,7 @@ struct NAMICAMERA_API FNamiCameraAdjustCurveBinding
 
 	FNamiCameraAdjustCurveBinding()
 		: InputSource(ENamiCameraAdjustInputSource::None)
+		, SourceName(NAME_None)
 		, Curve(nullptr)
 		, InputMin(0.f)
 		, InputMax(1.f)
@@ -31,6 +34,11 @@ struct NAMICAMERA_API FNamiCameraAdjustCurveBinding
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input")
 	ENamiCameraAdjustInputSource InputSource;
 
+	/** 注册输入源名称（InputSource 为 Registered 时使用） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input",
+		meta = (EditCondition = "InputSource == ENamiCameraAdjustInputSource::Registered", EditConditionHides))
+	FName SourceName;
+
 	/** 映射曲线（输入0-1，输出由曲线定义） */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Curve")
 	UCurveFloat* Curve;
@@ -94,7 +102,7 @@ struct NAMICAMERA_API FNamiCameraAdjustCurveBinding
 		float CurveOutput = 1.f;
 		if (Curve)
 		{
-			CurveOutput = Curve->GetFloatValue(NormalizedInput);
+			CurveOutput = CurveLUT.Evaluate(Curve, NormalizedInput);
 		}
 		else
 		{
@@ -105,11 +113,49 @@ struct NAMICAMERA_API FNamiCameraAdjustCurveBinding
 		return CurveOutput * OutputScale + OutputOffset;
 	}
 
+	/**
+	 * 从本帧输入快照读取输入源的原始值
+	 * @param Inputs 组件本帧的输入快照
+	 * @param ActiveTime 调整器激活后经过的时间（Time 输入源）
+	 * @param CustomInput 调整器的自定义输入（Custom 输入源）
+	 */
+	float ResolveInput(const FNamiCameraInputSnapshot& Inputs, float ActiveTime, float CustomInput) const
+	{
+		switch (InputSource)
+		{
+		case ENamiCameraAdjustInputSource::MoveSpeed:
+			return Inputs.MoveSpeed;
+		case ENamiCameraAdjustInputSource::LookSpeed:
+			return Inputs.LookSpeed;
+		case ENamiCameraAdjustInputSource::Time:
+			return ActiveTime;
+		case ENamiCameraAdjustInputSource::Custom:
+			return CustomInput;
+		case ENamiCameraAdjustInputSource::Registered:
+			return Inputs.GetSourceValue(SourceName, CachedSourceIndex);
+		default:
+			return 0.f;
+		}
+	}
+
+	/** 读取输入源并评估曲线 */
+	float Evaluate(const FNamiCameraInputSnapshot& Inputs, float ActiveTime, float CustomInput) const
+	{
+		return Evaluate(ResolveInput(Inputs, ActiveTime, CustomInput));
+	}
+
 	/** 检查此绑定是否有效（有输入源） */
 	bool IsValid() const
 	{
 		return InputSource != ENamiCameraAdjustInputSource::None;
 	}
+
+private:
+	/** Curve 的共享查找表 */
+	FNamiCameraCurveLUTRef CurveLUT;
+
+	/** SourceName 在快照注册输入源中的索引缓存 */
+	mutable int32 CachedSourceIndex = INDEX_NONE;
 };
 
 /**
@@ -0,0 +1,104 @@
+// Copyright Qiu, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/NamiCameraEnums.h"
+#include "Core/NamiCameraCurveCache.h"
+#include "Core/NamiCameraInputSnapshot.h"
+#include "NamiCameraAdjustParams.h"
+#include "NamiCameraAdjustCurveBinding.h"
+#include "NamiCameraAdjustLayer.generated.h"
+
+class UCurveFloat;
+
+/**
+ * 轻量相机调整层
+ *
+ * 只使用静态参数、混合时间与曲线绑定的调整（如动画通知）不需要 UObject：
+ * 数据按值连续存放在组件的层数组中，每帧在一个原生循环中推进混合并求值，不经过 ProcessEvent，也没有虚函数调用。
+ * 行为与只调用 SetStaticParams 的 UNamiCameraAdjust 一致；需要自定义 Tick/CalculateAdjustParams 时仍使用 UNamiCameraAdjust。
+ */
+USTRUCT()
+struct NAMICAMERA_API FNamiCameraAdjustLayer
+{
+	GENERATED_BODY()
+
+	// ========== 配置 ==========
+
+	UPROPERTY()
+	float BlendInTime = 0.3f;
+
+	UPROPERTY()
+	float BlendOutTime = 0.3f;
+
+	UPROPERTY()
+	ENamiCameraBlendType BlendType = ENamiCameraBlendType::EaseInOut;
+
+	/** BlendType 为 CustomCurve 时使用 */
+	UPROPERTY()
+	TObjectPtr<UCurveFloat> BlendCurve = nullptr;
+
+	UPROPERTY()
+	int32 Priority = 0;
+
+	UPROPERTY()
+	bool bAllowPlayerInput = false;
+
+	UPROPERTY()
+	float InputInterruptThreshold = 1.0f;
+
+	/** Override 臂旋转目标（相对角色朝向） */
+	UPROPERTY()
+	FRotator ArmRotationTarget = FRotator::ZeroRotator;
+
+	UPROPERTY()
+	FNamiCameraAdjustParams StaticParams;
+
+	UPROPERTY()
+	FNamiCameraAdjustCurveConfig CurveConfig;
+
+	// ========== 求值 ==========
+
+	/** 推进混合状态与激活时间（与 UNamiCameraAdjust::UpdateBlending 一致） */
+	void Advance(float DeltaTime, const FNamiCameraInputSnapshot& Inputs);
+
+	/** 静态参数叠加曲线驱动参数后按当前权重缩放 */
+	FNamiCameraAdjustParams GetWeightedParams(const FNamiCameraInputSnapshot& Inputs) const;
+
+	void RequestDeactivate(bool bForceImmediate = false);
+
+	/** 输入打断：开始混出，并标记混出已同步 */
+	void TriggerInputInterrupt();
+
+	// ========== 状态 ==========
+
+	/** 组件分配的句柄，推送前为 INDEX_NONE；取自与调整器共用的推送序号，同时作为同优先级时的合并顺序 */
+	int32 GetId() const { return Id; }
+	void SetId(int32 InId) { Id = InId; }
+
+	float GetCurrentBlendWeight() const { return CurrentBlendWeight; }
+	ENamiCameraAdjustState GetState() const { return State; }
+	bool IsBlendingOut() const { return State == ENamiCameraAdjustState::BlendingOut; }
+	bool IsFullyInactive() const { return State == ENamiCameraAdjustState::Inactive; }
+	bool IsInputInterrupted() const { return bInputInterrupted; }
+	bool IsBlendOutSynced() const { return bBlendOutSynced; }
+	void MarkBlendOutSynced() { bBlendOutSynced = true; }
+	FRotator GetCachedWorldArmRotationTarget() const { return CachedWorldArmRotationTarget; }
+
+private:
+	float CalculateBlendAlpha(float LinearAlpha) const;
+	float EvaluateCurveBinding(const FNamiCameraAdjustCurveBinding& Binding, const FNamiCameraInputSnapshot& Inputs) const;
+
+	int32 Id = INDEX_NONE;
+	ENamiCameraAdjustState State = ENamiCameraAdjustState::Inactive;
+	float CurrentBlendWeight = 0.f;
+	float BlendTimer = 0.f;
+	float ActiveTime = 0.f;
+	bool bInputInterrupted = false;
+	bool bBlendOutSynced = false;
+	FRotator CachedWorldArmRotationTarget = FRotator::ZeroRotator;
+
+	/** BlendCurve 的共享查找表 */
+	FNamiCameraCurveLUTRef BlendCurveLUT;
+};
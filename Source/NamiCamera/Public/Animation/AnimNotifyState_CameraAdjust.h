@@ -7,7 +7,6 @@
 #include "Adjustments/NamiCameraAdjustParams.h"
 #include "AnimNotifyState_CameraAdjust.generated.h"
 
-class UNamiCameraAdjust;
 class UNamiCameraComponent;
 
 /**
@@ -24,6 +23,10 @@ class UNamiCameraComponent;
  * 1. 在动画序列中添加此通知状态
  * 2. 配置需要调整的相机参数
  * 3. 设置混合时间
+ *
+ * 注意：通知以轻量调整层（PushAdjustLayer）推送，不进入调整器堆栈。GetAdjusts、HasAdjust、FindAdjust、
+ * PopAdjustByClass 看不到它，KeepExisting 也只在轻量层之间去重，不会与代码推送的 UNamiCameraAdjust 互斥；
+ * 需要查询或清除时使用 HasAdjustLayers / PopAdjustLayers。
  */
 UCLASS(DisplayName = "Camera Adjust", meta = (Tooltip = "相机调整通知。用于在技能动画中调整相机FOV、距离、位置等参数。"))
 class NAMICAMERA_API UAnimNotifyState_CameraAdjust : public UAnimNotifyState
@@ -155,9 +158,8 @@ protected:
 	FNamiCameraAdjustParams BuildAdjustParams() const;
 
 private:
-	/** 激活的调整器实例 */
-	UPROPERTY()
-	TWeakObjectPtr<UNamiCameraAdjust> ActiveAdjust;
+	/** 激活的轻量调整层句柄 */
+	int32 ActiveLayerId = INDEX_NONE;
 
 	/** 缓存的相机组件 */
 	TWeakObjectPtr<UNamiCameraComponent> CachedCameraComponent;
@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "Core/NamiBlendConfig.h"
 #include "Core/NamiCameraView.h"
+#include "Core/NamiCameraState.h"
+#include "Core/NamiCameraCurveCache.h"
 #include "UObject/Object.h"
 #include "NamiCameraModeBase.generated.h"
 
@@ -39,6 +41,46 @@ struct NAMICAMERA_API FNamiCameraModeSettings
 	float ViewPitchMax = 89.0f;
 };
 
+/**
+ * 相机模式输入签名
+ *
+ * 记录决定模式视图的外部输入（Pawn 变换、控制旋转、跟随目标等），用于判断两帧之间输入是否变化。
+ * 值按收集顺序比较，收集顺序在同一模式内应保持固定。
+ */
+struct NAMICAMERA_API FNamiCameraModeInputSignature
+{
+	void Add(const FVector& Value) { Values.Add(Value); }
+	void Add(const FRotator& Value) { Values.Add(FVector(Value.Pitch, Value.Yaw, Value.Roll)); }
+	void Reset() { Values.Reset(); }
+	bool IsEmpty() const { return Values.Num() == 0; }
+
+	/** 逐值比较（位置单位 cm，旋转单位度） */
+	bool Equals(const FNamiCameraModeInputSignature& Other, double Tolerance) const
+	{
+		if (Values.Num() != Other.Values.Num())
+		{
+			return false;
+		}
+		for (int32 Index = 0; Index < Values.Num(); ++Index)
+		{
+			if (!Values[Index].Equals(Other.Values[Index], Tolerance))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * 内联容量，按内置模式中最长的签名确定，收集时不分配堆内存：
+	 * 基类 3（Pawn 位置/旋转、控制旋转）+ 可组合模式 3（控制旋转、目标位置/旋转）+ 双焦点 2（锁定焦点、轨道输入）
+	 */
+	static constexpr int32 InlineCapacity = 8;
+
+private:
+	TArray<FVector, TInlineAllocator<InlineCapacity>> Values;
+};
+
 /**
  * 相机模式基类
  *
@@ -178,6 +220,18 @@ public:
 	/** 设置相机组件 */
 	void SetCameraComponent(UNamiCameraComponent* NewCameraComponent);
 
+	/**
+	 * 重置混合状态（同步 BlendConfig、混合权重从 0 开始、清空沿用视图）
+	 * 每次推送时由 Initialize 调用
+	 */
+	void ResetBlendState();
+
+	/**
+	 * 预热：只执行一次性构建（如创建运行时默认计算器），不绑定相机组件、不初始化
+	 * 由 WarmUpCameraMode 调用；推送时仍完整执行 Initialize，其中已存在的对象不会重复创建
+	 */
+	virtual void Prewarm() {}
+
 	/** 是否激活 */
 	UFUNCTION(BlueprintPure, Category = "Camera Mode")
 	bool IsActive() const { return State == ENamiCameraModeState::Active; }
@@ -193,6 +247,9 @@ public:
 	/** 获取视图（供 Stack 使用，与 EnhancedCameraSystem 保持一致） */
 	const FNamiCameraView& GetView() const { return CurrentView; }
 
+	/** 获取参数空间状态（供 Stack 使用，未启用 bBlendInParameterSpace 时为空） */
+	const FNamiCameraState* GetCameraState() const { return bBlendInParameterSpace ? &CurrentState : nullptr; }
+
 	/** 获取上一次计算的相机位置 */
 	UFUNCTION(BlueprintPure, Category = "Camera Mode")
 	FVector GetLastCameraLocation() const { return CurrentView.CameraLocation; }
@@ -209,6 +266,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Camera Mode")
 	void SetBlendWeight(float InWeight);
 
+	/**
+	 * 收集决定视图的外部输入（沿用视图时使用）
+	 * 基类记录 Pawn 位置/旋转与控制旋转；读取其他外部状态的子类应追加对应的值。
+	 */
+	virtual void GatherInputSignature(FNamiCameraModeInputSignature& OutSignature) const;
+
 	/** 获取 FAlphaBlendArgs 引用（供 Stack 使用，与 EnhancedCameraSystem 兼容） */
 	FAlphaBlendArgs& GetBlendAlpha() { return BlendStack; }
 
@@ -223,6 +286,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera Mode|Blending")
 	FNamiBlendConfig BlendConfig;
 
+	/**
+	 * 以参数空间状态参与栈混合
+	 * 栈中所有参与混合的模式都启用时，Stack 对吊臂长度、枢轴旋转等参数插值后统一计算相机位置，
+	 * 吊臂长度不同的模式之间沿圆弧过渡；任一模式未启用时回退到视图混合。
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera Mode|Blending")
+	bool bBlendInParameterSpace = false;
+
 	/** 混合参数（内部使用，与 EnhancedCameraSystem 兼容） */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera Mode|Blending", meta = (ExposeOnSpawn, DisplayAfter = "BlendConfig"))
 	FAlphaBlendArgs BlendStack;
@@ -236,6 +307,22 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera Mode")
 	int32 Priority = 0;
 
+	/**
+	 * 输入未变且已稳定时沿用上一次视图
+	 * 输入签名不变、前后两次输出一致、所有组件 IsSettled 时跳过视图计算与组件更新。
+	 * 可由 NamiCamera.Mode.ReuseSettledView 全局覆盖。
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera Mode|Performance")
+	bool bReuseSettledView = false;
+
+	/**
+	 * 连续沿用视图的最大帧数，达到后强制重新计算一次
+	 * 碰撞、遮挡等依赖场景的组件不在输入签名中，靠定期刷新跟上场景变化
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera Mode|Performance",
+		meta = (ClampMin = "1", EditCondition = "bReuseSettledView"))
+	int32 MaxReusedViewFrames = 10;
+
 protected:
 
 	/** 相机组件 */
@@ -258,6 +345,16 @@ protected:
 	/** 当前视图 */
 	FNamiCameraView CurrentView;
 
+	/** 当前参数空间状态（bBlendInParameterSpace 启用时随视图更新） */
+	FNamiCameraState CurrentState;
+
+	/**
+	 * 构建参数空间状态（每次完整计算视图后调用）
+	 * 默认由应用组件后的最终视图反推；直接以吊臂参数计算的子类可重写以输出原生状态，
+	 * 只标记实际参与计算的参数即可。
+	 */
+	virtual void BuildCameraState(FNamiCameraState& OutState) const;
+
 	/** FAlphaBlend 实例（用于管理混合权重） */
 	UPROPERTY(BlueprintReadOnly, Category = "Camera Mode", meta = (AllowPrivateAccess = "true"))
 	FAlphaBlend CameraBlendAlpha;
@@ -265,6 +362,9 @@ protected:
 	/** 混合权重 */
 	float BlendWeight = 0.0f;
 
+	/** BlendStack.CustomCurve 的共享查找表 */
+	FNamiCameraCurveLUTRef BlendCurveLUT;
+
 	/** 当前状态 */
 	ENamiCameraModeState State = ENamiCameraModeState::None;
 
@@ -292,5 +392,24 @@ protected:
 	 */
 	void SortComponents();
 
+	/** 是否启用沿用视图（CVar 覆盖 bReuseSettledView） */
+	bool ShouldReuseSettledView() const;
+
+	/** 所有启用的组件是否都已稳定 */
+	bool AreComponentsSettled() const;
+
+	/** 清空沿用视图的状态（初始化/激活时，或输入签名失效时调用） */
+	void ResetSettledState();
+
+private:
+	/** 上一次完整计算时的输入签名 */
+	FNamiCameraModeInputSignature LastInputSignature;
+
+	/** 输入签名与输出连续保持不变的帧数 */
+	int32 SettledFrames = 0;
+
+	/** 当前已连续沿用视图的帧数 */
+	int32 ReusedViewFrames = 0;
+
 };
 
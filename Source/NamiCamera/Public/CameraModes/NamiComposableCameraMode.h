@@ -42,6 +42,7 @@ public:
 	virtual void Activate_Implementation() override;
 	virtual void Deactivate_Implementation() override;
 	virtual FNamiCameraView CalculateView_Implementation(float DeltaTime) override;
+	virtual void GatherInputSignature(FNamiCameraModeInputSignature& OutSignature) const override;
 
 	// ========== 目标管理 ==========
 
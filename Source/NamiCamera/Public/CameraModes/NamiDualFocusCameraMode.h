@@ -35,8 +35,10 @@ public:
 	// ========== 生命周期 ==========
 
 	virtual void Initialize_Implementation(UNamiCameraComponent* InCameraComponent) override;
+	virtual void Prewarm() override;
 	virtual void Activate_Implementation() override;
 	virtual FNamiCameraView CalculateView_Implementation(float DeltaTime) override;
+	virtual void GatherInputSignature(FNamiCameraModeInputSignature& OutSignature) const override;
 
 	// ========== 锁定目标管理 ==========
 
@@ -87,6 +89,9 @@ protected:
 	/** 创建默认计算器 */
 	void CreateDefaultCalculators();
 
+	/** 运行时创建缺失的默认计算器（Initialize 与 Prewarm 共用） */
+	void CreateRuntimeCalculators();
+
 	/** 创建并注册 LockOn 组件 */
 	void SetupLockOnComponent();
 
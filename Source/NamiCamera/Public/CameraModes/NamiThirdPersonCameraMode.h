@@ -31,6 +31,7 @@ public:
 	// ========== 生命周期 ==========
 
 	virtual void Initialize_Implementation(UNamiCameraComponent* InCameraComponent) override;
+	virtual void Prewarm() override;
 
 	// ========== 快捷配置 ==========
 
@@ -44,6 +45,9 @@ protected:
 	/** 创建默认计算器 */
 	void CreateDefaultCalculators();
 
+	/** 运行时创建缺失的默认计算器（Initialize 与 Prewarm 共用） */
+	void CreateRuntimeCalculators();
+
 	/** 创建默认组件 */
 	void CreateDefaultComponents();
 };
@@ -36,6 +36,7 @@ public:
 	// ========== 生命周期 ==========
 
 	virtual void Initialize_Implementation(UNamiCameraComponent* InCameraComponent) override;
+	virtual void Prewarm() override;
 
 	// ========== 计算器访问 ==========
 
@@ -56,4 +57,7 @@ protected:
 	 * 创建默认计算器
 	 */
 	void CreateDefaultCalculators();
+
+	/** 运行时创建缺失的默认计算器（Initialize 与 Prewarm 共用） */
+	void CreateRuntimeCalculators();
 };
@@ -6,24 +6,75 @@
 #include "Camera/CameraComponent.h"
 
 // NamiCamera 模块头文件（按字母顺序排列）
+#include "Adjustments/NamiCameraAdjustLayer.h"
 #include "Adjustments/NamiCameraAdjustParams.h"
 #include "CameraModes/NamiCameraModeBase.h"
 #include "Core/NamiCameraModeHandle.h"
 #include "Core/NamiCameraModeStack.h"
+#include "Core/NamiCameraFlightRecorder.h"
+#include "Core/NamiCameraModePriorityStack.h"
 #include "Core/NamiCameraModeStackEntry.h"
 #include "Core/NamiCameraPipelineContext.h"
+#include "Core/NamiCameraReplay.h"
+#include "Core/NamiCameraSceneQueryBroker.h"
+#include "Core/NamiCameraFrameBudget.h"
+#include "Core/NamiCameraInputSnapshot.h"
 
 #include "NamiCameraComponent.generated.h"
 
 // 前向声明
 class ANamiPlayerCameraManager;
 class UNamiCameraAdjust;
+class UInputAction;
+struct FStreamableHandle;
 
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPushCameraModeDelegate, UNamiCameraModeBase *, CameraModeInstance);
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnPopCameraModeDelegate);
 
+/** 相机模式实例池统计 */
+struct FNamiCameraModePoolStats
+{
+	/** 推送时命中池中已有实例的次数 */
+	int32 Hits = 0;
+
+	/** 推送时池中没有实例、当帧创建的次数 */
+	int32 Misses = 0;
+
+	/** 预热创建的实例数 */
+	int32 Prewarmed = 0;
+
+	/** 正在异步加载的类数 */
+	int32 PendingLoads = 0;
+};
+
+/** 相机调整器实例池统计 */
+struct FNamiCameraAdjustPoolStats
+{
+	/** 取出时命中池中空闲实例的次数 */
+	int32 Hits = 0;
+
+	/** 取出时池中没有空闲实例、新建的次数 */
+	int32 Misses = 0;
+
+	/** 移出堆栈后归还到池中的次数 */
+	int32 Released = 0;
+
+	/** 池已满或池化关闭、交给 GC 回收的次数 */
+	int32 Discarded = 0;
+};
+
+/** 同一调整器类的实例列表（空闲实例池与堆栈类索引共用） */
+USTRUCT()
+struct FNamiCameraAdjustBucket
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<UNamiCameraAdjust>> Instances;
+};
+
 /**
  * Nami相机组件
  * 管理相机模式堆栈和混合，提供完整的相机管线处理。
@@ -39,6 +90,7 @@ public:
 	// ========== UActorComponent ==========
 	virtual void InitializeComponent() override;
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	// ========== End UActorComponent ==========
 
 	// ========== UCameraComponent ==========
@@ -56,6 +108,26 @@ public:
 	/** 获取所有者PlayerCameraManager */
 	ANamiPlayerCameraManager* GetOwnerPlayerCameraManager() const;
 
+	/** 本帧相机输入快照（GetCameraView 开始时采样一次） */
+	const FNamiCameraInputSnapshot& GetInputSnapshot() const { return InputSnapshot; }
+
+	/**
+	 * 注册输入源，曲线绑定以 Registered + SourceName 读取
+	 * 每帧采样快照时调用 Sampler 一次；同名输入源已存在时替换其回调
+	 */
+	void RegisterInputSource(FName Name, TFunction<float()> Sampler);
+
+	/** 注销输入源（含 SetInputChannelValue 创建的通道） */
+	UFUNCTION(BlueprintCallable, Category = "NamiCamera|Input")
+	void UnregisterInputSource(FName Name);
+
+	/**
+	 * 设置输入通道的值，不存在时按名称注册
+	 * 新值在下一帧采样快照时生效；已通过 RegisterInputSource 注册回调的输入源以回调为准
+	 */
+	UFUNCTION(BlueprintCallable, Category = "NamiCamera|Input")
+	void SetInputChannelValue(FName Name, float Value);
+
 	// ========== Debug ==========
 
 	/** 打印当前的相机模式堆栈 */
@@ -66,6 +138,22 @@ public:
 	/** 获取默认相机模式类 */
 	TSubclassOf<UNamiCameraModeBase> GetDefaultCameraModeClass() const { return DefaultCameraMode; }
 
+	/** 获取相机模式优先级堆栈（调试用） */
+	const TArray<FNamiCameraModeStackEntry>& GetCameraModePriorityStack() const { return CameraModePriorityStack.GetEntries(); }
+
+	/** 获取混合堆栈（调试用） */
+	const FNamiCameraModeStack& GetBlendingStack() const { return BlendingStack; }
+
+	/** 获取飞行记录器（最近一帧阶段耗时始终可用） */
+	const FNamiCameraFlightRecorder& GetFlightRecorder() const { return FlightRecorder; }
+
+	/** 获取场景查询代理（相机管线内的射线/扫掠都应经由它发起） */
+	FNamiCameraSceneQueryBroker& GetSceneQueryBroker() { return SceneQueryBroker; }
+	const FNamiCameraSceneQueryBroker& GetSceneQueryBroker() const { return SceneQueryBroker; }
+
+	/** 获取当前帧预算降级等级（模式组件据此跳过可省略的工作） */
+	ENamiCameraDegradeLevel GetDegradeLevel() const { return FrameBudgetGuard.GetLevel(); }
+
 #if WITH_EDITOR
 	/** Draw debug camera info (editor only) */
 	void DrawDebugCameraInfo(const struct FNamiCameraView& View) const;
@@ -85,6 +173,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "NamiCamera|Modes")
 	bool PopCameraMode(UPARAM(ref) FNamiCameraModeHandle& ModeHandle);
 
+	/** 句柄是否属于本组件且对应的条目仍在优先级堆栈中 */
+	bool IsCameraModeHandleAlive(const FNamiCameraModeHandle& ModeHandle) const;
+
 	/** 使用实例移除相机模式 */
 	UFUNCTION(BlueprintCallable, Category = "NamiCamera|Modes")
 	bool PopCameraModeInstance(UNamiCameraModeBase* CameraMode);
@@ -93,6 +184,24 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "NamiCamera|Modes")
 	UNamiCameraModeBase* GetActiveCameraMode() const;
 
+	/**
+	 * 加载完成后创建实例并执行一次性构建（Prewarm：NewObject、运行时默认计算器），首次推送时不再产生这些开销；每次推送仍完整执行 Initialize。
+	 * 加载完成后创建实例并执行一次 Initialize（构建计算器、排序组件），首次推送时不再产生这些开销。
+	 * 模式类直接引用的曲线等资源随类一起异步加载。已加载的类立即预热。
+	 */
+	UFUNCTION(BlueprintCallable, Category = "NamiCamera|Modes")
+	void PreloadCameraModeClasses(const TArray<TSoftClassPtr<UNamiCameraModeBase>>& CameraModeClasses);
+
+	/** 同步预热已加载的相机模式类（池中已有实例时不做任何事） */
+	UFUNCTION(BlueprintCallable, Category = "NamiCamera|Modes")
+	void WarmUpCameraMode(TSubclassOf<UNamiCameraModeBase> CameraModeClass);
+
+	/** 获取相机模式实例池统计 */
+	const FNamiCameraModePoolStats& GetCameraModePoolStats() const { return CameraModePoolStats; }
+
+	/** 打印相机模式实例池统计到日志 */
+	void DumpCameraModePoolStats() const;
+
 	// ========== Camera Modifier ==========
 
 	/** 推送CameraModifier */
@@ -118,6 +227,7 @@ public:
 	 * @param AdjustClass 调整器类
 	 * @param DuplicatePolicy 同类重复处理策略（默认保持现有，防止跳变）
 	 * @return 创建的调整器实例，如果策略为KeepExisting且已存在则返回现有实例
+	 * 返回的实例不进入调整器池，移出堆栈后对其调用 PopAdjust 是安全的空操作
 	 */
 	UFUNCTION(BlueprintCallable, Category = "NamiCamera|Adjustments", meta = (DisplayName = "Push Adjust"))
 	UNamiCameraAdjust* PushAdjust(TSubclassOf<UNamiCameraAdjust> AdjustClass,
@@ -152,25 +262,26 @@ public:
 	bool PopAdjustByClass(TSubclassOf<UNamiCameraAdjust> AdjustClass, bool bForceImmediate = false);
 
 	/**
-	 * 通过类型查找相机调整器
+	 * 通过类型查找相机调整器（包括子类）
 	 * @tparam T 调整器类型
 	 * @return 找到的调整器，如果不存在则返回nullptr
 	 */
 	template <typename T>
 	T* FindAdjust() const
 	{
-		for (UNamiCameraAdjust* Adjust : CameraAdjustStack)
-		{
-			if (T* TypedAdjust = Cast<T>(Adjust))
-			{
-				return TypedAdjust;
-			}
-		}
-		return nullptr;
+		return Cast<T>(FindAdjustByBaseClass(T::StaticClass()));
 	}
 
 	/**
-	 * 通过类查找相机调整器
+	 * 查找指定类或其子类的相机调整器（堆栈中最靠前的一个，与遍历堆栈一致）
+	 * 只遍历堆栈中出现过的类，而不是所有实例
+	 * @param BaseClass 调整器基类
+	 * @return 找到的调整器
+	 */
+	UNamiCameraAdjust* FindAdjustByBaseClass(UClass* BaseClass) const;
+
+	/**
+	 * 通过类查找相机调整器（同类有多个时返回堆栈中最靠前的一个，重复策略据此选择被替换的实例）
 	 * @param AdjustClass 调整器类
 	 * @return 找到的调整器
 	 */
@@ -179,6 +290,8 @@ public:
 
 	/**
 	 * 获取所有激活的相机调整器
+	 * 返回堆栈本身的视图（不复制），索引与堆栈位置一致。已被 GC 清空的调整器在下一次 CleanupInactiveCameraAdjusts 之前
+	 * 以 nullptr 保留在原位置，使用前请检查 IsValid。
 	 * @return 调整器列表
 	 */
 	UFUNCTION(BlueprintPure, Category = "NamiCamera|Adjustments")
@@ -192,6 +305,67 @@ public:
 	UFUNCTION(BlueprintPure, Category = "NamiCamera|Adjustments")
 	bool HasAdjust(TSubclassOf<UNamiCameraAdjust> AdjustClass) const;
 
+	/**
+	 * 从调整器池取出一个实例，池中没有空闲实例时新建
+	 * 取出的实例已恢复为类默认配置，推送前可自由修改；未推送成功时应调用 ReleaseAdjust 归还。
+	 * 实例移出堆栈（完全混出或立即弹出）后自动归还，调用方不应在此之后继续使用；
+	 * 需要在之后弹出时，先比较推送时记录的 GetPoolSerial，不一致说明实例已被复用。
+	 * @param AdjustClass 调整器类
+	 * @return 调整器实例
+	 */
+	UFUNCTION(BlueprintCallable, Category = "NamiCamera|Adjustments")
+	UNamiCameraAdjust* AcquireAdjust(TSubclassOf<UNamiCameraAdjust> AdjustClass);
+
+	/**
+	 * 将调整器实例归还到池中
+	 * 仍在堆栈中、不属于本组件、或不是由 AcquireAdjust 取得的实例会被忽略。
+	 * @param AdjustInstance 调整器实例
+	 */
+	UFUNCTION(BlueprintCallable, Category = "NamiCamera|Adjustments")
+	void ReleaseAdjust(UNamiCameraAdjust* AdjustInstance);
+
+	/** 获取相机调整器实例池统计 */
+	const FNamiCameraAdjustPoolStats& GetAdjustPoolStats() const { return AdjustPoolStats; }
+
+	/** 打印相机调整器实例池统计到日志 */
+	void DumpAdjustPoolStats() const;
+
+	/**
+	 * 推送轻量调整层
+	 * 只有静态参数、混合时间与曲线绑定的调整（如动画通知）使用此接口，不创建 UObject。
+	 * 重复策略只在轻量层之间生效（所有层视为同一类），不与堆栈中的 UNamiCameraAdjust 去重。
+	 * 轻量层不在调整器堆栈中：GetAdjusts、HasAdjust、FindAdjust、PopAdjustByClass 都不包含它们，
+	 * 请使用 GetAdjustLayers / HasAdjustLayers / PopAdjustLayers。
+	 * @param Layer 层配置
+	 * @param DuplicatePolicy 重复处理策略
+	 * @return 层句柄，被 KeepExisting 拒绝时返回 INDEX_NONE
+	 */
+	int32 PushAdjustLayer(const FNamiCameraAdjustLayer& Layer,
+	                      ENamiCameraAdjustDuplicatePolicy DuplicatePolicy = ENamiCameraAdjustDuplicatePolicy::KeepExisting);
+
+	/**
+	 * 弹出轻量调整层
+	 * @param LayerId PushAdjustLayer 返回的句柄
+	 * @param bForceImmediate 是否立即移除（跳过BlendOut）
+	 * @return 是否找到该层
+	 */
+	bool PopAdjustLayer(int32 LayerId, bool bForceImmediate = false);
+
+	/**
+	 * 弹出所有轻量调整层（如清除动画通知推送的调整）
+	 * @param bForceImmediate 是否立即移除（跳过BlendOut）
+	 * @return 是否弹出了至少一层
+	 */
+	UFUNCTION(BlueprintCallable, Category = "NamiCamera|Adjustments")
+	bool PopAdjustLayers(bool bForceImmediate = false);
+
+	/** 是否存在轻量调整层（包括正在混出的层） */
+	UFUNCTION(BlueprintPure, Category = "NamiCamera|Adjustments")
+	bool HasAdjustLayers() const { return AdjustLayers.Num() > 0; }
+
+	/** 获取所有轻量调整层（按优先级升序） */
+	const TArray<FNamiCameraAdjustLayer>& GetAdjustLayers() const { return AdjustLayers; }
+
 protected:
 	/** 组件初始化时使用的默认相机模式 */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Settings",
@@ -236,6 +410,15 @@ protected:
 	/** 从池中查找或添加相机模式实例 */
 	UNamiCameraModeBase* FindOrAddCameraModeInstanceInPool(TSubclassOf<UNamiCameraModeBase> CameraModeClass);
 
+	/** 在池中查找相机模式实例（不计入统计） */
+	UNamiCameraModeBase* FindCameraModeInstanceInPool(TSubclassOf<UNamiCameraModeBase> CameraModeClass) const;
+
+	/** 创建相机模式实例并加入池 */
+	UNamiCameraModeBase* CreateCameraModeInstanceInPool(TSubclassOf<UNamiCameraModeBase> CameraModeClass);
+
+	/** 预加载请求完成回调 */
+	void OnCameraModePreloadCompleted(TArray<TSoftClassPtr<UNamiCameraModeBase>> CameraModeClasses);
+
 	/** 在指定索引处移除相机模式 */
 	bool PullCameraModeAtIndex(int32 Index);
 
@@ -268,6 +451,14 @@ protected:
 	 */
 	FNamiCameraAdjustParams CalculateCombinedAdjustParams(float DeltaTime, const FRotator& CurrentArmRotation, const FNamiCameraView& CurrentView);
 
+	/**
+	 * 将单个调整器（UNamiCameraAdjust 或 FNamiCameraAdjustLayer）的加权参数合并到结果中
+	 * 处理各参数的混合模式、玩家输入打断与混出时的 ControlRotation 同步
+	 */
+	template <typename AdjustType>
+	void AccumulateAdjustParams(AdjustType& Adjust, const FNamiCameraAdjustParams& AdjustParams, const FRotator& CurrentArmRotation,
+		const FNamiCameraView& CurrentView, FNamiCameraAdjustParams& CombinedParams, FQuat& CombinedArmRotationQuat, bool& bHasArmRotation);
+
 	/**
 	 * 将调整参数应用到视图
 	 * @param Params 调整参数
@@ -281,12 +472,21 @@ protected:
 	void CleanupInactiveCameraAdjusts();
 
 	/**
-	 * 检测是否有玩家相机旋转输入
-	 * @param Threshold 输入阈值（鼠标移动超过此值视为有输入）
+	 * 检测是否有玩家相机旋转输入（读取本帧输入快照）
+	 * @param Threshold 输入阈值（鼠标增量单位，摇杆输入已按 StickLookInputScale 换算）
 	 * @return 是否检测到输入
 	 */
 	bool DetectPlayerCameraInput(float Threshold) const;
 
+	/** 采样本帧相机输入快照 */
+	void UpdateInputSnapshot();
+
+	/** 读取归一化摇杆视角输入：优先 INamiCameraInputProvider（Pawn、PlayerController），其次 LookInputAction */
+	FVector2D ReadStickLookInput(const APlayerController* PC) const;
+
+	/** 按名称查找输入源，不存在时追加到末尾（快照中的名称同步追加） */
+	FNamiCameraInputSourceRegistration& FindOrAddInputSource(FName Name);
+
 	/**
 	 * 同步臂旋转到 PlayerController 的 ControlRotation
 	 * 用于输入打断时，确保玩家从当前臂旋转位置接管控制
@@ -348,23 +548,186 @@ protected:
 		meta = (ClampMin = "0.0", UIMin = "0.0", UIMax = "3600.0"))
 	float ControlRotationBlendSpeed = 360.0f;
 
+	// ========== 场景查询预算 ==========
+
+	/** 每帧场景查询预算（次），超出后可延迟的查询推迟到下一帧。0 = 不限制 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance",
+		meta = (ClampMin = "0", UIMax = "64",
+			Tooltip = "每帧相机场景查询（射线/扫掠）上限。防穿墙碰撞始终执行，遮挡检测等可延迟的查询在超出后推迟到下一帧。0 = 不限制"))
+	int32 SceneQueryBudget = 0;
+
+	// ========== 帧预算 ==========
+
+	/** GetCameraView 耗时预算（毫秒），超出后逐级降级。0 = 不降级 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance",
+		meta = (ClampMin = "0.0", UIMax = "5.0",
+			Tooltip = "单帧相机管线耗时超出此值时，后续帧依次：复用碰撞结果 -> 跳过遮挡检测 -> 仅评估栈顶模式；耗时回落后自动逐级恢复。0 = 不降级"))
+	float FrameBudgetMs = 0.0f;
+
+	/** 回退一级降级所需的连续低耗时帧数 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance",
+		meta = (ClampMin = "1", UIMax = "300"))
+	int32 FrameBudgetRecoverFrames = 30;
+
+	/** 非栈顶模式完整评估所需的最小有效贡献，低于该值时只推进混合权重。0 = 始终完整评估 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance",
+		meta = (ClampMin = "0.0", ClampMax = "0.1",
+			Tooltip = "快速切换模式时，被上层模式压到接近 0 的模式跳过 CalculateView 与模式组件（含碰撞扫掠），视图沿用上一次评估的结果。0 = 始终完整评估"))
+	float ModeMinContribution = 0.001f;
+
+	/** 同时评估的相机模式数上限，超出时最老的模式合并为冻结快照。0 = 不限制 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance",
+		meta = (ClampMin = "0", UIMax = "16",
+			Tooltip = "频繁推送模式时，超出上限的最老模式按当前混合结果合并为一个冻结视图，作为栈底淡出且不再评估，最坏情况开销与推送次数无关。0 = 不限制"))
+	int32 ModeStackMaxDepth = 4;
+
+	/** 每个调整器类最多保留的空闲实例数。0 = 不池化 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance",
+		meta = (ClampMin = "0", UIMax = "16",
+			Tooltip = "动画通知与 PushAdjust 创建的调整器移出堆栈后保留在池中复用，避免战斗中频繁创建对象带来的 GC 压力。0 = 不池化"))
+	int32 MaxPooledAdjustsPerClass = 4;
+
+	/** BeginPlay 时异步加载并预热的相机模式（与项目设置中的全局列表合并） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance",
+		meta = (Tooltip = "BeginPlay 时异步加载这些相机模式类并预先创建、初始化实例，避免战斗中首次推送时卡顿。DefaultCameraMode 无需列出"))
+	TArray<TSoftClassPtr<UNamiCameraModeBase>> PreloadCameraModes;
+
+	// ========== 相机输入 ==========
+
+	/** 视角输入动作（Axis2D），Pawn 与 PlayerController 未实现 INamiCameraInputProvider 时读取 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NamiCamera|Input",
+		meta = (Tooltip = "Enhanced Input 视角动作。其值按归一化摇杆处理，建议只映射手柄摇杆；鼠标始终按鼠标增量读取"))
+	TObjectPtr<UInputAction> LookInputAction = nullptr;
+
+	/** 摇杆视角输入的径向死区 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NamiCamera|Input",
+		meta = (ClampMin = "0.0", ClampMax = "0.95"))
+	float LookInputDeadZone = 0.15f;
+
+	/** 摇杆视角输入换算为鼠标增量的倍率 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NamiCamera|Input",
+		meta = (ClampMin = "0.0", UIMax = "20.0",
+			Tooltip = "归一化摇杆输入乘以此值后与鼠标增量比较，使调整器的 InputInterruptThreshold 与 LookSpeed 曲线对鼠标和手柄一致"))
+	float StickLookInputScale = 5.0f;
+
+	// ========== 飞行记录器 ==========
+
+	/** 是否启用飞行记录器（记录最近 N 帧的管线中间结果） */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Debug|FlightRecorder",
+		meta = (Tooltip = "记录最近 N 帧的各阶段视图、阶段耗时与模式权重，超出预算或执行 NamiCamera.FlightRecorder.Dump 时写入文件"))
+	bool bEnableFlightRecorder = false;
+
+	/** 飞行记录器容量（帧） */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Debug|FlightRecorder",
+		meta = (EditCondition = "bEnableFlightRecorder", ClampMin = "1", UIMax = "3600"))
+	int32 FlightRecorderCapacity = 300;
+
+	/** GetCameraView 耗时预算（毫秒），超出时自动转储。0 = 不自动转储 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Debug|FlightRecorder",
+		meta = (EditCondition = "bEnableFlightRecorder", ClampMin = "0.0",
+			Tooltip = "单帧相机管线耗时超出此值时自动转储记录。0 = 仅手动转储"))
+	float FlightRecorderBudgetMs = 2.0f;
+
+	/** 两次自动转储的最小间隔（秒） */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Debug|FlightRecorder",
+		meta = (EditCondition = "bEnableFlightRecorder", ClampMin = "0.0"))
+	float FlightRecorderDumpCooldown = 5.0f;
+
+public:
+	/**
+	 * 将飞行记录器缓冲写入 Saved/NamiCamera/FlightRecorder/
+	 * @param Reason 文件名中附带的原因标记
+	 */
+	UFUNCTION(BlueprintCallable, Category = "NamiCamera|Debug")
+	void DumpFlightRecorder(const FString& Reason = TEXT("Manual"));
+
+	// ========== 回放录制 ==========
+
+	/** 开始录制相机管线输入（每帧输入与模式/调整器堆栈事件） */
+	UFUNCTION(BlueprintCallable, Category = "NamiCamera|Debug")
+	void StartReplayRecording();
+
+	/**
+	 * 停止录制并写入文件
+	 * @param FilePath 目标路径，为空时写入 Saved/NamiCamera/Replay/
+	 * @return 是否写入成功
+	 */
+	UFUNCTION(BlueprintCallable, Category = "NamiCamera|Debug")
+	bool StopReplayRecording(const FString& FilePath = TEXT(""));
+
+	/** 是否在录制 */
+	bool IsReplayRecording() const { return ReplayRecorder.IsRecording(); }
+
+	/** 读取本帧输入快照的原始鼠标增量（不含摇杆，回放时为注入值）；合并后的视角输入见 GetInputSnapshot().LookInput */
+	void GetInputMouseDelta(float& OutTurn, float& OutLook) const;
+
+	/** 设置回放注入的鼠标增量（重置后恢复从 PlayerController 读取） */
+	void SetInputMouseDeltaOverride(const TOptional<FVector2D>& InOverride) { InputMouseDeltaOverride = InOverride; }
+
+	/** 设置回放注入的合并视角输入（重置后恢复由鼠标与摇杆合并） */
+	void SetLookInputOverride(const TOptional<FVector2D>& InOverride) { LookInputOverride = InOverride; }
+
+	/** 相机时间（秒）：碰撞检测频率、遮挡检测间隔等按时间节流的逻辑使用；回放时为录制时间 */
+	double GetCameraTimeSeconds() const;
+
+	/** 设置回放注入的相机时间（重置后恢复读取 World 时间） */
+	void SetTimeSecondsOverride(const TOptional<double>& InOverride) { TimeSecondsOverride = InOverride; }
+
+	/** 挂起帧预算守卫（回放时使用：降级等级固定为 None，不随墙钟耗时与 ForceLevel 变化） */
+	void SetFrameBudgetSuspended(bool bSuspended) { FrameBudgetGuard.SetSuspended(bSuspended); }
+
 private:
 	/** 相机模式实例池（使用 TMap 实现 O(1) 查找） */
 	UPROPERTY()
 	TMap<TSubclassOf<UNamiCameraModeBase>, TObjectPtr<UNamiCameraModeBase>> CameraModeInstancePool;
 
-	/** 相机模式优先级堆栈 */
-	UPROPERTY()
-	TArray<FNamiCameraModeStackEntry> CameraModePriorityStack;
+	/** 实例池统计 */
+	FNamiCameraModePoolStats CameraModePoolStats;
+
+	/** 进行中的预加载请求（EndPlay 时取消） */
+	TArray<TSharedPtr<FStreamableHandle>> CameraModePreloadHandles;
+
+	/** 相机模式优先级堆栈（槽位表 + 优先级视图，句柄查找 O(1)） */
+	FNamiCameraModePriorityStack CameraModePriorityStack;
 
 	/** 混合堆栈 */
 	UPROPERTY()
 	FNamiCameraModeStack BlendingStack;
 
-	/** 相机调整器堆栈（按优先级排序） */
+	/** 相机调整器堆栈（按推送时的优先级排序） */
 	UPROPERTY()
 	TArray<TObjectPtr<UNamiCameraAdjust>> CameraAdjustStack;
 
+	/** 与 CameraAdjustStack 一一对应的排序键（实例被 GC 清空或 Priority 被修改后仍保持有序，供二分查找） */
+	TArray<FNamiCameraAdjustStackKey> CameraAdjustStackKeys;
+
+	/** 下一个推送序号（调整器与轻量调整层共用，同优先级时按推送顺序合并） */
+	int32 NextAdjustPushSequence = 0;
+
+	/** 堆栈中调整器的类索引（类 -> 实例，按堆栈顺序），与 CameraAdjustStack 同步增量维护 */
+	UPROPERTY()
+	TMap<TObjectPtr<UClass>, FNamiCameraAdjustBucket> AdjustClassIndex;
+
+	/** 调整器是否在堆栈中（经类索引查找） */
+	bool IsAdjustInStack(const UNamiCameraAdjust* Adjust) const;
+
+	/** 从堆栈与类索引中移除指定位置的调整器 */
+	void RemoveAdjustAt(int32 StackIndex);
+
+	/** 查找调整器在堆栈中的位置（按排序键二分定位） */
+	int32 FindAdjustStackIndex(const UNamiCameraAdjust* Adjust) const;
+
+	/** 轻量调整层（按优先级升序，连续存放） */
+	UPROPERTY()
+	TArray<FNamiCameraAdjustLayer> AdjustLayers;
+
+	/** 相机调整器空闲实例池（按类） */
+	UPROPERTY()
+	TMap<TObjectPtr<UClass>, FNamiCameraAdjustBucket> AdjustPool;
+
+	/** 调整器实例池统计 */
+	FNamiCameraAdjustPoolStats AdjustPoolStats;
+
 	// ========== 输入打断调试 ==========
 	/** 输入打断后的帧计数器（用于调试日志） */
 	int32 InputInterruptDebugFrameCounter = 0;
@@ -377,4 +740,34 @@ private:
 	bool bPendingControlRotationSync = false;
 	/** 待同步的 ControlRotation */
 	FRotator PendingControlRotation;
+
+	// ========== 飞行记录器 ==========
+	FNamiCameraFlightRecorder FlightRecorder;
+
+	/** 上次自动转储的时间（秒） */
+	double LastFlightRecorderDumpTime = -UE_BIG_NUMBER;
+
+	// ========== 场景查询 ==========
+	FNamiCameraSceneQueryBroker SceneQueryBroker;
+
+	// ========== 帧预算 ==========
+	FNamiCameraFrameBudgetGuard FrameBudgetGuard;
+
+	// ========== 回放 ==========
+	FNamiCameraReplayRecorder ReplayRecorder;
+
+	/** 回放注入的鼠标增量 */
+	TOptional<FVector2D> InputMouseDeltaOverride;
+
+	/** 回放注入的合并视角输入 */
+	TOptional<FVector2D> LookInputOverride;
+
+	/** 回放注入的相机时间 */
+	TOptional<double> TimeSecondsOverride;
+
+	// ========== 相机输入 ==========
+	FNamiCameraInputSnapshot InputSnapshot;
+
+	/** 注册输入源，顺序与 InputSnapshot.SourceNames 一致 */
+	TArray<FNamiCameraInputSourceRegistration> InputSources;
 };
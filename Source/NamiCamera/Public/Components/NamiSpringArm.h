@@ -8,6 +8,8 @@
 #include "UObject/ObjectMacros.h"
 #include "NamiSpringArm.generated.h"
 
+class FNamiCameraSceneQueryBroker;
+
 /**
  * SpringArm
  */
@@ -55,6 +57,19 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=CameraCollision, meta=(EditCondition="bDoCollisionTest", ClampMin="0.0", ClampMax="0.5", UIMin="0.0", UIMax="0.5"))
 	float CollisionCacheTime = 0.0f;
 
+	/** 超出相机场景查询预算时是否允许推迟碰撞检测（推迟的帧沿用上一次的命中距离） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=CameraCollision, AdvancedDisplay, meta=(EditCondition="bDoCollisionTest"))
+	bool bAllowDeferredCollisionTest = false;
+
+	/** 场景查询代理（由所属组件在 Tick 前设置，为空时直接查询且不计入预算） */
+	FNamiCameraSceneQueryBroker* QueryBroker = nullptr;
+
+	/** 帧预算降级时由所属组件置位：已有探针结果时直接复用，不再扫掠 */
+	bool bReuseLastProbe = false;
+
+	/** 碰撞检测频率控制使用的当前时间（由所属组件在 Tick 前设置为相机时间，回放时为录制时间；未设置时读取 World 时间） */
+	TOptional<double> TimeSecondsOverride;
+
 	/** 是否使用平滑过渡从碰撞位置恢复到期望位置 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=CameraCollision, meta=(EditCondition="bDoCollisionTest", InlineEditConditionToggle))
 	bool bEnableSmoothCollisionRecovery = true;
@@ -197,5 +212,19 @@ private:
 
 	/** 当前碰撞恢复位置 */
 	FVector CurrentCollisionRecoveryLocation = FVector::ZeroVector;
+
+	/** 经由查询代理发起探针扫掠；被推迟时沿用上一次的命中距离 */
+	bool SweepProbe(const UWorld* World, const FVector& ArmOrigin, const FVector& DesiredLoc, const FCollisionQueryParams& QueryParams, FVector& OutHitLocation);
+
+	/** 沿当前 Arm 方向复用上一次的探针结果 */
+	bool ReuseLastProbe(const FVector& ArmOrigin, const FVector& DesiredLoc, FVector& OutHitLocation) const;
+
+	/** 上一次实际执行的探针结果（命中距离沿 Arm 方向计算） */
+	bool bHasLastProbe = false;
+	bool bLastProbeHit = false;
+	float LastProbeHitDistance = 0.0f;
+
+	/** 单个忽略 Actor 重载使用的复用缓冲 */
+	TArray<AActor*> SingleIgnoreActorBuffer;
 };
 
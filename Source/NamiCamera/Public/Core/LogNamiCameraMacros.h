@@ -6,11 +6,15 @@
 #include "Settings/NamiCameraSettings.h"
 #include "Engine/Engine.h"
 #include "Core/LogNamiCamera.h"
+#include "Core/NamiCameraLogFlags.h"
 
 /**
  * Nami相机系统日志宏
  * 根据 Settings 中的开关控制是否打印日志
  * 支持同时输出到 Log 和屏幕
+ *
+ * 开关读取 FNamiCameraLogFlags 缓存的位掩码，日志关闭时每次调用仅一次整数判断
+ * NAMICAMERA_ENABLE_VERBOSE_LOGS 为 0 时（Shipping/Test 默认），除警告外的分类完全编译剔除
  */
 
 // ========== 内部辅助宏 ==========
@@ -42,62 +46,50 @@
 		} \
 	} while(0)
 
-// ========== 效果/修改器日志 ==========
-#define NAMI_LOG_EFFECT(Verbosity, Format, ...) \
+/**
+ * 按分类开关输出（Log + 屏幕）
+ */
+#define NAMI_LOG_CATEGORY(LogFlag, ScreenFlag, Verbosity, Format, ...) \
 	do { \
-		if (UNamiCameraSettings::ShouldLogEffect()) \
+		if (FNamiCameraLogFlags::IsSet(LogFlag)) \
 		{ \
 			NAMI_LOG_TO_LOG(Verbosity, Format, ##__VA_ARGS__); \
 		} \
-		if (UNamiCameraSettings::ShouldLogEffectOnScreen()) \
+		if (FNamiCameraLogFlags::IsSet(ScreenFlag)) \
 		{ \
 			NAMI_LOG_TO_SCREEN(Format, ##__VA_ARGS__); \
 		} \
 	} while(0)
 
-// ========== State计算日志 ==========
-#define NAMI_LOG_STATE(Verbosity, Format, ...) \
+/**
+ * 编译剔除的日志：参数仍参与语法检查（避免调用处出现未使用变量），但不会生成任何代码
+ */
+#define NAMI_LOG_COMPILED_OUT(Format, ...) \
 	do { \
-		if (UNamiCameraSettings::ShouldLogStateCalculation()) \
+		if (false) \
 		{ \
-			NAMI_LOG_TO_LOG(Verbosity, Format, ##__VA_ARGS__); \
-		} \
-		if (UNamiCameraSettings::ShouldLogStateCalculationOnScreen()) \
-		{ \
-			NAMI_LOG_TO_SCREEN(Format, ##__VA_ARGS__); \
+			(void)FString::Printf(Format, ##__VA_ARGS__); \
 		} \
 	} while(0)
 
+#if NAMICAMERA_ENABLE_VERBOSE_LOGS
+
+// ========== 效果/修改器日志 ==========
+#define NAMI_LOG_EFFECT(Verbosity, Format, ...) \
+	NAMI_LOG_CATEGORY(ENamiCameraLogFlag::Effect, ENamiCameraLogFlag::EffectOnScreen, Verbosity, Format, ##__VA_ARGS__)
+
+// ========== State计算日志 ==========
+#define NAMI_LOG_STATE(Verbosity, Format, ...) \
+	NAMI_LOG_CATEGORY(ENamiCameraLogFlag::StateCalculation, ENamiCameraLogFlag::StateCalculationOnScreen, Verbosity, Format, ##__VA_ARGS__)
+
 // ========== 组件日志 ==========
 #define NAMI_LOG_COMPONENT(Verbosity, Format, ...) \
-	do { \
-		if (UNamiCameraSettings::ShouldLogComponent()) \
-		{ \
-			NAMI_LOG_TO_LOG(Verbosity, Format, ##__VA_ARGS__); \
-		} \
-		if (UNamiCameraSettings::ShouldLogComponentOnScreen()) \
-		{ \
-			NAMI_LOG_TO_SCREEN(Format, ##__VA_ARGS__); \
-		} \
-	} while(0)
-
-// ========== 警告日志 ==========
-#define NAMI_LOG_WARNING(Format, ...) \
-	do { \
-		if (UNamiCameraSettings::ShouldLogWarning()) \
-		{ \
-			NAMI_LOG_TO_LOG(Warning, Format, ##__VA_ARGS__); \
-		} \
-		if (UNamiCameraSettings::ShouldLogWarningOnScreen()) \
-		{ \
-			NAMI_LOG_TO_SCREEN(Format, ##__VA_ARGS__); \
-		} \
-	} while(0)
+	NAMI_LOG_CATEGORY(ENamiCameraLogFlag::Component, ENamiCameraLogFlag::ComponentOnScreen, Verbosity, Format, ##__VA_ARGS__)
 
 // ========== 堆栈日志（使用现有开关，暂不支持屏幕输出）==========
 #define NAMI_LOG_STACK(Verbosity, Format, ...) \
 	do { \
-		if (UNamiCameraSettings::ShouldEnableStackDebugLog()) \
+		if (FNamiCameraLogFlags::IsSet(ENamiCameraLogFlag::StackDebug)) \
 		{ \
 			NAMI_LOG_TO_LOG(Verbosity, Format, ##__VA_ARGS__); \
 		} \
@@ -105,40 +97,28 @@
 
 // ========== 相机信息日志（关键相机参数）==========
 #define NAMI_LOG_CAMERA_INFO(Verbosity, Format, ...) \
-	do { \
-		if (UNamiCameraSettings::ShouldLogCameraInfo()) \
-		{ \
-			NAMI_LOG_TO_LOG(Verbosity, Format, ##__VA_ARGS__); \
-		} \
-		if (UNamiCameraSettings::ShouldLogCameraInfoOnScreen()) \
-		{ \
-			NAMI_LOG_TO_SCREEN(Format, ##__VA_ARGS__); \
-		} \
-	} while(0)
+	NAMI_LOG_CATEGORY(ENamiCameraLogFlag::CameraInfo, ENamiCameraLogFlag::CameraInfoOnScreen, Verbosity, Format, ##__VA_ARGS__)
 
 // ========== 模式混合日志（模式切换和混合过程）==========
 #define NAMI_LOG_MODE_BLEND(Verbosity, Format, ...) \
-	do { \
-		if (UNamiCameraSettings::ShouldLogModeBlend()) \
-		{ \
-			NAMI_LOG_TO_LOG(Verbosity, Format, ##__VA_ARGS__); \
-		} \
-		if (UNamiCameraSettings::ShouldLogModeBlendOnScreen()) \
-		{ \
-			NAMI_LOG_TO_SCREEN(Format, ##__VA_ARGS__); \
-		} \
-	} while(0)
+	NAMI_LOG_CATEGORY(ENamiCameraLogFlag::ModeBlend, ENamiCameraLogFlag::ModeBlendOnScreen, Verbosity, Format, ##__VA_ARGS__)
 
 // ========== 输入打断日志（CameraAdjust 输入打断和混出同步）==========
 #define NAMI_LOG_INPUT_INTERRUPT(Verbosity, Format, ...) \
-	do { \
-		if (UNamiCameraSettings::ShouldLogInputInterrupt()) \
-		{ \
-			NAMI_LOG_TO_LOG(Verbosity, Format, ##__VA_ARGS__); \
-		} \
-		if (UNamiCameraSettings::ShouldLogInputInterruptOnScreen()) \
-		{ \
-			NAMI_LOG_TO_SCREEN(Format, ##__VA_ARGS__); \
-		} \
-	} while(0)
+	NAMI_LOG_CATEGORY(ENamiCameraLogFlag::InputInterrupt, ENamiCameraLogFlag::InputInterruptOnScreen, Verbosity, Format, ##__VA_ARGS__)
+
+#else
 
+#define NAMI_LOG_EFFECT(Verbosity, Format, ...) NAMI_LOG_COMPILED_OUT(Format, ##__VA_ARGS__)
+#define NAMI_LOG_STATE(Verbosity, Format, ...) NAMI_LOG_COMPILED_OUT(Format, ##__VA_ARGS__)
+#define NAMI_LOG_COMPONENT(Verbosity, Format, ...) NAMI_LOG_COMPILED_OUT(Format, ##__VA_ARGS__)
+#define NAMI_LOG_STACK(Verbosity, Format, ...) NAMI_LOG_COMPILED_OUT(Format, ##__VA_ARGS__)
+#define NAMI_LOG_CAMERA_INFO(Verbosity, Format, ...) NAMI_LOG_COMPILED_OUT(Format, ##__VA_ARGS__)
+#define NAMI_LOG_MODE_BLEND(Verbosity, Format, ...) NAMI_LOG_COMPILED_OUT(Format, ##__VA_ARGS__)
+#define NAMI_LOG_INPUT_INTERRUPT(Verbosity, Format, ...) NAMI_LOG_COMPILED_OUT(Format, ##__VA_ARGS__)
+
+#endif // NAMICAMERA_ENABLE_VERBOSE_LOGS
+
+// ========== 警告日志 ==========
+#define NAMI_LOG_WARNING(Format, ...) \
+	NAMI_LOG_CATEGORY(ENamiCameraLogFlag::Warning, ENamiCameraLogFlag::WarningOnScreen, Warning, Format, ##__VA_ARGS__)
@@ -27,5 +27,9 @@ struct NAMICAMERA_API FNamiBlendConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Blending",
 		meta = (EditCondition = "BlendType == ENamiCameraBlendType::CustomCurve"))
 	TObjectPtr<UCurveFloat> BlendCurve;
+
+	/** 过渡方式（惯性化时 BlendTime 为偏移衰减时间，BlendType 不生效） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Blending")
+	ENamiCameraTransitionType TransitionType = ENamiCameraTransitionType::CrossFade;
 };
 
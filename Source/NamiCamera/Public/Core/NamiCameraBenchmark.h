@@ -0,0 +1,103 @@
+// Copyright Qiu, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/SubclassOf.h"
+#include "UObject/ObjectPtr.h"
+
+class APawn;
+class APlayerController;
+class ANamiPlayerCameraManager;
+class UWorld;
+class UNamiCameraModeBase;
+
+/**
+ * 无头场景中生成的临时对象（基准测试与回放共用）
+ * PlayerController 持有 DefaultPawn，并使用 NamiPlayerCameraManager
+ */
+struct NAMICAMERA_API FNamiCameraScenarioActors
+{
+	TObjectPtr<APlayerController> PC;
+	TObjectPtr<ANamiPlayerCameraManager> CameraManager;
+	TObjectPtr<APawn> Pawn;
+
+	/** 在世界中生成对象，失败时返回 false（已生成的对象需调用 Destroy 清理） */
+	bool Spawn(UWorld* World);
+
+	/** 销毁生成的对象 */
+	void Destroy();
+};
+
+/**
+ * 相机管线基准测试配置
+ *
+ * 每个配置对应一个场景：在当前世界中生成 Pawn / PlayerController / NamiPlayerCameraManager / NamiCameraComponent，
+ * 然后以固定 DeltaTime 驱动 GetCameraView 指定帧数。
+ */
+struct NAMICAMERA_API FNamiCameraBenchmarkConfig
+{
+	/** 场景名称（输出 JSON 用） */
+	FString Name;
+
+	/** 相机模式类（栈中每一层都使用该类的新实例） */
+	TSubclassOf<UNamiCameraModeBase> ModeClass;
+
+	/** 模式栈深度 */
+	int32 StackDepth = 1;
+
+	/** CameraAdjust 实例数量 */
+	int32 AdjustCount = 0;
+
+	/** 每个模式额外添加的模式组件数量 */
+	int32 ExtraComponentCount = 0;
+
+	/** 是否开启弹簧臂碰撞检测（没有弹簧臂的模式会补一个） */
+	bool bCollision = false;
+
+	/** 预热帧数（不计入统计） */
+	int32 WarmupFrames = 120;
+
+	/** 采样帧数 */
+	int32 Frames = 5000;
+
+	/** 固定帧时间 */
+	float DeltaTime = 1.0f / 60.0f;
+};
+
+/**
+ * 相机管线基准测试结果
+ */
+struct NAMICAMERA_API FNamiCameraBenchmarkResult
+{
+	FString Name;
+	int32 Frames = 0;
+	double MeanNs = 0.0;
+	double P50Ns = 0.0;
+	double P99Ns = 0.0;
+	double MaxNs = 0.0;
+
+	/** 每帧平均堆分配次数（分配器不支持计数时为 -1） */
+	double AllocsPerFrame = -1.0;
+
+	/** 序列化为单个 JSON 对象 */
+	FString ToJson() const;
+};
+
+/**
+ * 相机管线基准测试
+ *
+ * 控制台命令：NamiCamera.Benchmark [Mode=ThirdPerson|DualFocus|TopDown|All] [Frames=N] [Depth=N]
+ *                                   [Adjusts=N] [Components=N] [Collision=0|1|Both] [Out=文件路径]
+ *
+ * 可在 -nullrhi 的无头进程中通过 -ExecCmds 调用，结果写入 Saved/NamiCamera/Benchmark.json，
+ * 供插件升级时做性能回归比对。
+ */
+struct NAMICAMERA_API FNamiCameraBenchmark
+{
+	/** 运行单个场景 */
+	static bool RunScenario(UWorld* World, const FNamiCameraBenchmarkConfig& Config, FNamiCameraBenchmarkResult& OutResult);
+
+	/** 将结果数组序列化为 JSON */
+	static FString ResultsToJson(const TArray<FNamiCameraBenchmarkResult>& Results);
+};
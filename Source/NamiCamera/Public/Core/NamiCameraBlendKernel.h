@@ -0,0 +1,39 @@
+// Copyright Qiu, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FNamiCameraState;
+struct FNamiCameraView;
+
+/**
+ * 相机视图多层混合内核
+ *
+ * 层顺序与 FNamiCameraModeStack 相同：索引 0 为栈顶，最后一层为栈底（混合基础）；Contributions 为各层有效贡献。
+ *
+ * Blend 一次遍历完成 N 层混合：先由贡献求出每层在顺序混合结果中的最终权重，
+ * 再将吊臂方向、相机/控制器四元数、控制器位置与 (吊臂长度, FOV) 分别作为 4 宽向量寄存器加权累加，
+ * 四元数与吊臂方向在全部层累加后统一归一化。各层视图按常量引用读取，不复制。
+ *
+ * BlendSequential 为原有的逐层 FNamiCameraView::Blend 实现，作为精度参考与回退路径。
+ * 二者的位置/FOV 在常见混合范围内一致；旋转由欧拉角插值改为四元数插值，差异随层间夹角增大。
+ *
+ * BlendStates 在参数空间混合：各层 FNamiCameraState 自栈底向上按贡献只插值被修改的输入参数，
+ * 最后统一 ComputeOutput 一次。吊臂长度与枢轴旋转分别插值，相机沿以枢轴为圆心的圆弧过渡。
+ */
+struct NAMICAMERA_API FNamiCameraBlendKernel
+{
+	/** 一次遍历的向量化混合 */
+	static void Blend(TConstArrayView<const FNamiCameraView*> Views, TConstArrayView<float> Contributions, FNamiCameraView& OutView);
+
+	/** 逐层顺序混合（参考实现） */
+	static void BlendSequential(TConstArrayView<const FNamiCameraView*> Views, TConstArrayView<float> Contributions, FNamiCameraView& OutView);
+
+	/**
+	 * 参数空间混合（不分配内存）
+	 * 贡献大于 0 的层与栈底必须提供状态，其余层的状态可为空；控制器位置/旋转仍取自 Views。
+	 */
+	static void BlendStates(TConstArrayView<const FNamiCameraState*> States, TConstArrayView<const FNamiCameraView*> Views,
+		TConstArrayView<float> Contributions, FNamiCameraState& OutState, FNamiCameraView& OutView);
+};
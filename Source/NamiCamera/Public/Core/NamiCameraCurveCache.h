@@ -0,0 +1,93 @@
+// Copyright Qiu, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UCurveFloat;
+
+/**
+ * 烘焙后的曲线查找表
+ *
+ * 在曲线关键帧的时间范围内均匀采样 Resolution + 1 个点，求值时只做一次线性插值。
+ * 范围外：外插为常量时取端点值，否则回退到曲线本身求值。
+ * 对“常量”插值的阶跃关键帧，阶跃会被平滑到一个采样间隔内。
+ */
+class NAMICAMERA_API FNamiCameraCurveLUT
+{
+public:
+	/** 采样间隔数 */
+	static constexpr int32 Resolution = 256;
+
+	explicit FNamiCameraCurveLUT(const UCurveFloat* InCurve);
+
+	/** 按曲线时间求值（与 UCurveFloat::GetFloatValue 对应） */
+	float Evaluate(float Time) const;
+
+	/** 按 [0, 1] 映射到关键帧时间范围求值（与 FAlphaBlend 的 Custom 曲线对应） */
+	float EvaluateNormalized(float Alpha) const;
+
+	/** 烘焙来源 */
+	const UCurveFloat* GetCurve() const { return Curve.Get(); }
+
+	/** 曲线资源已修改，需要重新获取 */
+	bool IsStale() const { return bStale; }
+
+private:
+	friend class FNamiCameraCurveCache;
+
+	/** 在 [0, Resolution] 的采样坐标上插值 */
+	float Sample(float Position) const;
+
+	TWeakObjectPtr<const UCurveFloat> Curve;
+	TArray<float> Samples;
+	float MinTime = 0.0f;
+	float MaxTime = 0.0f;
+	float SamplesPerSecond = 0.0f;
+	bool bConstantPreInfinity = true;
+	bool bConstantPostInfinity = true;
+	bool bStale = false;
+};
+
+/**
+ * 曲线查找表缓存（仅游戏线程）
+ *
+ * 同一曲线资源只烘焙一次，由所有持有者共享；最后一个持有者释放后查找表随之释放。
+ * 编辑器中曲线资源被修改时对应查找表标记为过期，持有者在下次求值时重新获取。
+ */
+class NAMICAMERA_API FNamiCameraCurveCache
+{
+public:
+	/** 获取（必要时烘焙）曲线的查找表 */
+	static TSharedPtr<const FNamiCameraCurveLUT> Acquire(const UCurveFloat* Curve);
+
+	/** 使曲线的查找表失效 */
+	static void Invalidate(const UCurveFloat* Curve);
+
+	/** 模块启动/关闭时调用（注册编辑器资源修改回调） */
+	static void Startup();
+	static void Shutdown();
+};
+
+/**
+ * 曲线查找表引用
+ *
+ * 放在曲线的使用方旁边：首次求值时从缓存获取，曲线被替换或查找表过期时自动重新获取。
+ */
+struct NAMICAMERA_API FNamiCameraCurveLUTRef
+{
+	/** 按曲线时间求值，Curve 为空时返回 Time */
+	float Evaluate(const UCurveFloat* Curve, float Time) const;
+
+	/** 按 [0, 1] 映射到关键帧时间范围求值，Curve 为空时返回 Alpha */
+	float EvaluateNormalized(const UCurveFloat* Curve, float Alpha) const;
+
+	/** 释放引用 */
+	void Reset() { LUT.Reset(); }
+
+private:
+	const FNamiCameraCurveLUT* Resolve(const UCurveFloat* Curve) const;
+
+	mutable TSharedPtr<const FNamiCameraCurveLUT> LUT;
+};
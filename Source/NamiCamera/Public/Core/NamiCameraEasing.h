@@ -0,0 +1,58 @@
+// Copyright Qiu, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/NamiCameraEnums.h"
+
+/**
+ * 相机混合缓动函数
+ *
+ * 模式、调整器与效果组件共用，ENamiCameraBlendType 在各处含义一致。
+ * 与 FMath::InterpEaseIn/InterpEaseOut/InterpEaseInOut（指数 2）逐点一致，
+ * 但以二次多项式闭式计算，不调用 pow；缓入缓出的两段以条件选择合并，不产生分支。
+ * 输入按 [0, 1] 的混合 Alpha 处理，与参考函数一样不做限制。
+ */
+struct FNamiCameraEasing
+{
+	/** 缓入：t^2 */
+	static FORCEINLINE float EaseIn(float Alpha)
+	{
+		return Alpha * Alpha;
+	}
+
+	/** 缓出：1 - (1 - t)^2 */
+	static FORCEINLINE float EaseOut(float Alpha)
+	{
+		const float Inv = 1.0f - Alpha;
+		return 1.0f - Inv * Inv;
+	}
+
+	/** 缓入缓出：前半段 2t^2，后半段 1 - 2(1 - t)^2 */
+	static FORCEINLINE float EaseInOut(float Alpha)
+	{
+		const float Inv = 1.0f - Alpha;
+		const float In = 2.0f * Alpha * Alpha;
+		const float Out = 1.0f - 2.0f * Inv * Inv;
+		return Alpha < 0.5f ? In : Out;
+	}
+
+	/**
+	 * 按混合类型缓动
+	 * CustomCurve 由调用方经曲线查找表求值，这里按线性处理
+	 */
+	static FORCEINLINE float Ease(ENamiCameraBlendType BlendType, float Alpha)
+	{
+		switch (BlendType)
+		{
+		case ENamiCameraBlendType::EaseIn:
+			return EaseIn(Alpha);
+		case ENamiCameraBlendType::EaseOut:
+			return EaseOut(Alpha);
+		case ENamiCameraBlendType::EaseInOut:
+			return EaseInOut(Alpha);
+		default:
+			return Alpha;
+		}
+	}
+};
@@ -39,6 +39,18 @@ enum class ENamiCameraBlendType : uint8
 	CustomCurve UMETA(DisplayName = "自定义曲线"),
 };
 
+/**
+ * 相机模式切换的过渡方式
+ */
+UENUM(BlueprintType)
+enum class ENamiCameraTransitionType : uint8
+{
+	/** 交叉淡化：新旧模式在混合时间内同时评估并混合视图 */
+	CrossFade UMETA(DisplayName = "交叉淡化"),
+	/** 惯性化：旧模式立即移出，切换瞬间的偏移与速度在新模式之上衰减，每帧只评估一个模式 */
+	Inertialization UMETA(DisplayName = "惯性化"),
+};
+
 /**
  * 跟随目标类型
  */
@@ -134,6 +146,9 @@ enum class ENamiCameraAdjustInputSource : uint8
 
 	/** 自定义输入（通过 SetCustomInput 设置） */
 	Custom UMETA(DisplayName = "自定义"),
+
+	/** 组件注册的输入源（按 SourceName 查找，见 UNamiCameraComponent::RegisterInputSource） */
+	Registered UMETA(DisplayName = "注册输入源"),
 };
 
 /**
@@ -0,0 +1,146 @@
+// Copyright Qiu, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Camera/CameraTypes.h"
+#include "Core/NamiCameraView.h"
+
+/**
+ * 飞行记录器中按阶段计时的管线阶段
+ */
+enum class ENamiCameraFlightStage : uint8
+{
+	PreProcess,
+	ModeStack,
+	CameraAdjust,
+	ControllerSync,
+	Smoothing,
+	PostProcess,
+	Count
+};
+
+/**
+ * 单帧飞行记录
+ * 记录一帧内管线各阶段的中间视图、阶段耗时与模式堆栈权重
+ */
+struct NAMICAMERA_API FNamiCameraFlightRecord
+{
+	/** 每帧最多记录的模式权重数（超出部分截断） */
+	static constexpr int32 MaxModeWeights = 8;
+
+	uint64 FrameNumber = 0;
+	double WorldTime = 0.0;
+	float DeltaTime = 0.0f;
+
+	/** GetCameraView 总耗时（毫秒） */
+	float TotalMs = 0.0f;
+
+	/** 各阶段耗时（毫秒） */
+	float StageMs[static_cast<int32>(ENamiCameraFlightStage::Count)] = {};
+
+	/** ProcessModeStack 输出 */
+	FNamiCameraView BaseView;
+
+	/** ProcessCameraAdjusts 之后的视图 */
+	FNamiCameraView AdjustedView;
+
+	/** 控制器同步后的实际控制位置/旋转（目标值见 AdjustedView.Control*） */
+	FVector ControlLocation = FVector::ZeroVector;
+	FRotator ControlRotation = FRotator::ZeroRotator;
+
+	/** 平滑后的最终视图 */
+	FVector SmoothedLocation = FVector::ZeroVector;
+	FRotator SmoothedRotation = FRotator::ZeroRotator;
+	float SmoothedFOV = 0.0f;
+
+	/** 混合堆栈权重（索引 0 为栈顶） */
+	uint8 NumModeWeights = 0;
+	float ModeWeights[MaxModeWeights] = {};
+};
+
+/**
+ * 相机飞行记录器
+ *
+ * 固定容量环形缓冲，记录最近 N 帧的管线中间结果，稳态下不分配内存。
+ * 阶段计时始终进行（每阶段一次 Cycles64），最近一帧的耗时供调试器读取；环形缓冲仅在启用时写入。
+ * 当 GetCameraView 超出预算或执行控制台命令 NamiCamera.FlightRecorder.Dump 时，
+ * 将缓冲写为紧凑二进制文件（.ncfr），可用 NamiCamera.FlightRecorder.ToCsv <文件> 转换为 CSV。
+ */
+class NAMICAMERA_API FNamiCameraFlightRecorder
+{
+public:
+	/** 二进制文件魔数与版本 */
+	static constexpr uint32 FileMagic = 0x5246434E; // 'NCFR'
+	static constexpr uint32 FileVersion = 1;
+
+	/** 设置容量并清空缓冲（容量为 0 时关闭记录） */
+	void Initialize(int32 InCapacity);
+
+	/** 是否在记录 */
+	bool IsEnabled() const { return Records.Num() > 0; }
+
+	/** 开始新的一帧记录，返回可写入的记录（未启用时仅计时，返回空） */
+	FNamiCameraFlightRecord* BeginFrame(uint64 FrameNumber, double WorldTime, float DeltaTime);
+
+	/** 记录从上一次标记到现在的阶段耗时 */
+	void MarkStage(ENamiCameraFlightStage Stage);
+
+	/** 放弃当前帧（管线提前退出时） */
+	void CancelFrame();
+
+	/**
+	 * 结束当前帧并提交到环形缓冲
+	 * @return 本帧 GetCameraView 总耗时（毫秒）
+	 */
+	float EndFrame();
+
+	/** 当前帧记录（未开始时为空） */
+	FNamiCameraFlightRecord* GetCurrentRecord() const { return CurrentRecord; }
+
+	/** 最近一次完成的帧的各阶段耗时（毫秒），按 ENamiCameraFlightStage 索引 */
+	TConstArrayView<float> GetLastStageMs() const { return MakeArrayView(LastStageMs, UE_ARRAY_COUNT(LastStageMs)); }
+
+	/** 最近一次完成的帧的总耗时（毫秒） */
+	float GetLastTotalMs() const { return LastTotalMs; }
+
+	/** 已提交的记录数 */
+	int32 Num() const { return NumRecords; }
+
+	/** 将缓冲按时间顺序序列化为二进制 */
+	void Serialize(TArray<uint8>& OutBytes) const;
+
+	/**
+	 * 将缓冲异步写入文件
+	 * @param FilePath 目标文件路径
+	 */
+	void DumpToFile(const FString& FilePath) const;
+
+	/**
+	 * 读取二进制文件并转换为 CSV
+	 * @return 是否成功
+	 */
+	static bool ConvertToCsv(const FString& InFilePath, const FString& OutCsvPath);
+
+private:
+	/** 环形缓冲 */
+	TArray<FNamiCameraFlightRecord> Records;
+
+	/** 下一条写入位置 */
+	int32 WriteIndex = 0;
+
+	/** 已提交记录数（不超过容量） */
+	int32 NumRecords = 0;
+
+	/** 正在写入的记录 */
+	FNamiCameraFlightRecord* CurrentRecord = nullptr;
+
+	/** 帧开始与上次阶段标记的时间戳（0 表示当前没有进行中的帧） */
+	uint64 FrameStartCycles = 0;
+	uint64 LastStageCycles = 0;
+
+	/** 进行中的帧与最近完成帧的阶段耗时 */
+	float PendingStageMs[static_cast<int32>(ENamiCameraFlightStage::Count)] = {};
+	float LastStageMs[static_cast<int32>(ENamiCameraFlightStage::Count)] = {};
+	float LastTotalMs = 0.0f;
+};
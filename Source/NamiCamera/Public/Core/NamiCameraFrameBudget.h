@@ -0,0 +1,76 @@
+// Copyright Qiu, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 相机管线降级等级（逐级累加，高等级包含低等级的所有降级）
+ */
+enum class ENamiCameraDegradeLevel : uint8
+{
+	/** 不降级 */
+	None,
+
+	/** 弹簧臂沿用上一次的碰撞探针结果，不再扫掠 */
+	ReuseCollision,
+
+	/** 跳过目标可见性组件的遮挡检测 */
+	SkipOcclusion,
+
+	/** 仅完整评估栈顶模式，其余模式只推进混合权重并沿用上一帧视图 */
+	TopModeOnly,
+
+	Max = TopModeOnly
+};
+
+/**
+ * 相机帧预算守卫
+ *
+ * 每帧结束时提交 GetCameraView 耗时：超出预算时提升一级降级，
+ * 连续若干帧耗时低于预算的恢复比例时回退一级，直到恢复为 None。
+ * 预算为 0 时不降级；控制台变量 NamiCamera.FrameBudgetMs >= 0 时覆盖组件设置，
+ * NamiCamera.FrameBudget.ForceLevel >= 0 时强制使用指定等级（调试用）。
+ * 挂起时（回放）固定为 None，不受耗时与控制台变量影响，保证结果可复现。
+ */
+class NAMICAMERA_API FNamiCameraFrameBudgetGuard
+{
+public:
+	/** 恢复判定：耗时低于 预算 * RecoverRatio 的帧才算“便宜帧” */
+	static constexpr float RecoverRatio = 0.75f;
+
+	/**
+	 * 提交一帧耗时并更新降级等级（作用于后续帧）
+	 * @param FrameMs 本帧耗时（毫秒）
+	 * @param BudgetMs 预算（毫秒），0 表示关闭
+	 * @param RecoverFrames 回退一级所需的连续便宜帧数
+	 * @return 等级是否变化
+	 */
+	bool Update(float FrameMs, float BudgetMs, int32 RecoverFrames);
+
+	/** 当前降级等级 */
+	ENamiCameraDegradeLevel GetLevel() const;
+
+	/** 当前等级是否达到指定降级 */
+	bool IsDegraded(ENamiCameraDegradeLevel Level) const { return GetLevel() >= Level; }
+
+	/** 恢复为不降级 */
+	void Reset();
+
+	/** 挂起/恢复守卫（挂起期间等级固定为 None，Update 不生效） */
+	void SetSuspended(bool bInSuspended);
+	bool IsSuspended() const { return bSuspended; }
+
+	/** 解析实际预算（控制台变量优先） */
+	static float ResolveBudgetMs(float ComponentBudgetMs);
+
+private:
+	/** 当前等级 */
+	ENamiCameraDegradeLevel Level = ENamiCameraDegradeLevel::None;
+
+	/** 连续便宜帧计数 */
+	int32 CheapFrames = 0;
+
+	/** 是否挂起 */
+	bool bSuspended = false;
+};
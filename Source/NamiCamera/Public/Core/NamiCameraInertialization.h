@@ -0,0 +1,89 @@
+// Copyright Qiu, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FNamiCameraView;
+
+/**
+ * 单个标量偏移的惯性化衰减
+ *
+ * 以初始偏移 X0 与速度 V0 构造五次多项式，在 Duration 内衰减到 0，
+ * 且起点的位置、速度与终点的位置、速度、加速度都连续（Bollo, "Inertialization", GDC 2018）。
+ */
+struct NAMICAMERA_API FNamiInertializedScalar
+{
+	/**
+	 * 开始衰减
+	 * @param InX0 初始偏移
+	 * @param InV0 初始偏移速度
+	 * @param BlendTime 期望衰减时间（偏移速度较快时会自动缩短以避免过冲）
+	 */
+	void Begin(float InX0, float InV0, float BlendTime);
+
+	/** 求 Time 时刻的偏移 */
+	float Evaluate(float Time) const;
+
+	/** 实际衰减时间 */
+	float GetDuration() const { return Duration; }
+
+private:
+	float Sign = 1.0f;
+	float X0 = 0.0f;
+	float V0 = 0.0f;
+	float HalfA0 = 0.0f;
+	float A = 0.0f;
+	float B = 0.0f;
+	float C = 0.0f;
+	float Duration = 0.0f;
+};
+
+/**
+ * 相机视图惯性化过渡
+ *
+ * 模式切换时记录旧视图相对新模式视图的偏移（位置、旋转、FOV）及其速度，
+ * 之后每帧只评估新模式，并把解析衰减的偏移叠加在新模式的视图上。
+ * 位置偏移速度按旧视图相对 Pivot 的运动估计（假定新旧模式跟随同一目标）；旋转与 FOV 直接取旧视图的变化速度。
+ */
+class NAMICAMERA_API FNamiCameraInertializer
+{
+public:
+	/**
+	 * 开始过渡
+	 * @param PrevSource 旧视图的上一帧
+	 * @param Source 旧视图（切换前最后一帧的输出）
+	 * @param SourceDeltaTime Source 与 PrevSource 之间的帧时间
+	 * @param Target 新模式本帧的视图
+	 * @param BlendTime 衰减时间
+	 */
+	void Begin(const FNamiCameraView& PrevSource, const FNamiCameraView& Source, float SourceDeltaTime,
+		const FNamiCameraView& Target, float BlendTime);
+
+	/** 推进时间并将偏移叠加到视图上，衰减结束后自动停止 */
+	void Apply(float DeltaTime, FNamiCameraView& InOutView);
+
+	/** 是否在过渡中 */
+	bool IsActive() const { return bActive; }
+
+	/** 停止过渡 */
+	void Reset() { bActive = false; }
+
+private:
+	/** 位置偏移：沿固定方向衰减 */
+	FNamiInertializedScalar LocationOffset;
+	FVector LocationAxis = FVector::ZeroVector;
+
+	/** 旋转偏移：绕固定轴衰减（弧度） */
+	FNamiInertializedScalar RotationOffset;
+	FVector RotationAxis = FVector::UpVector;
+
+	/** FOV 偏移 */
+	FNamiInertializedScalar FOVOffset;
+
+	/** 已过时间与总时长 */
+	float Elapsed = 0.0f;
+	float Duration = 0.0f;
+
+	bool bActive = false;
+};
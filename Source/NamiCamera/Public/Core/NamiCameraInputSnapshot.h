@@ -0,0 +1,88 @@
+// Copyright Qiu, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 相机输入快照
+ *
+ * 由 UNamiCameraComponent 在每帧管线开始时采样一次，输入打断检测、所有调整器与轻量调整层的曲线绑定共用，
+ * 求值期间只读，同一帧内不再重复读取 Pawn、移动组件、PlayerController 或输入接口。
+ *
+ * 视角输入统一为鼠标增量单位：鼠标增量按原值记录；INamiCameraInputProvider 或 Enhanced Input 的归一化摇杆值
+ * 先经径向死区处理，再乘以组件的 StickLookInputScale；两者取较大者。回放时直接使用录制的值。
+ * 合并后的视角输入只用于输入打断检测与 LookSpeed 输入源；按帧累加视角的逻辑应读取原始鼠标增量 MouseDelta，
+ * 摇杆值是每帧都保持的偏转量，直接按帧累加会使转速随帧率变化。
+ *
+ * 注册输入源（RegisterInputSource / SetInputChannelValue）按注册顺序存放，曲线绑定缓存名称对应的索引，
+ * 求值时只做一次名称比较与数组读取。
+ */
+struct FNamiCameraInputSnapshot
+{
+	/** 本帧原始鼠标增量（X=Turn, Y=LookUp） */
+	FVector2D MouseDelta = FVector2D::ZeroVector;
+
+	/** 合并鼠标与摇杆后的视角输入（X=Yaw, Y=Pitch） */
+	FVector2D LookInput = FVector2D::ZeroVector;
+
+	/** 视角输入大小（LookSpeed 输入源） */
+	float LookSpeed = 0.f;
+
+	/** 角色移动速度（MoveSpeed 输入源） */
+	float MoveSpeed = 0.f;
+
+	/** 角色朝向（Override 臂旋转目标的参考） */
+	FRotator OwnerRotation = FRotator::ZeroRotator;
+
+	/** 注册输入源名称（仅在注册/注销时变化） */
+	TArray<FName, TInlineAllocator<8>> SourceNames;
+
+	/** 注册输入源本帧的值，与 SourceNames 一一对应 */
+	TArray<float, TInlineAllocator<8>> SourceValues;
+
+	/** 任一轴的视角输入超过阈值时视为玩家正在操作相机 */
+	bool HasLookInput(float Threshold) const
+	{
+		return FMath::Abs(LookInput.X) > Threshold || FMath::Abs(LookInput.Y) > Threshold;
+	}
+
+	/**
+	 * 读取注册输入源的值
+	 * @param Name 输入源名称
+	 * @param InOutIndex 调用方缓存的索引，名称不匹配时重新查找并更新
+	 * @return 未注册时为 0
+	 */
+	float GetSourceValue(FName Name, int32& InOutIndex) const
+	{
+		if (!SourceNames.IsValidIndex(InOutIndex) || SourceNames[InOutIndex] != Name)
+		{
+			InOutIndex = SourceNames.IndexOfByKey(Name);
+		}
+		return InOutIndex != INDEX_NONE ? SourceValues[InOutIndex] : 0.f;
+	}
+
+	/**
+	 * 径向死区：长度不超过 DeadZone 的输入归零，其余按 [DeadZone, 1] -> [0, 1] 重新映射，方向不变
+	 * @param Value 归一化输入（长度超过 1 时按 1 处理）
+	 */
+	static FVector2D ApplyRadialDeadZone(const FVector2D& Value, float DeadZone)
+	{
+		const float Size = Value.Size();
+		if (Size <= DeadZone || Size <= KINDA_SMALL_NUMBER)
+		{
+			return FVector2D::ZeroVector;
+		}
+
+		const float Remapped = (FMath::Min(Size, 1.f) - DeadZone) / FMath::Max(1.f - DeadZone, KINDA_SMALL_NUMBER);
+		return Value * (Remapped / Size);
+	}
+};
+
+/** 组件注册的输入源：有采样回调时每帧采样一次，否则使用最近一次 SetInputChannelValue 设置的值 */
+struct FNamiCameraInputSourceRegistration
+{
+	FName Name;
+	TFunction<float()> Sampler;
+	float ChannelValue = 0.f;
+};
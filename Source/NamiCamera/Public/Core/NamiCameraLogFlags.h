@@ -0,0 +1,69 @@
+// Copyright Qiu, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UNamiCameraSettings;
+
+/**
+ * 是否编译详细日志分类（效果/State/组件/相机信息/模式混合/输入打断/堆栈）
+ * Shipping/Test 下默认完全剔除，可在 Build.cs 中通过 PublicDefinitions 覆盖
+ * 警告日志不受此开关影响
+ */
+#ifndef NAMICAMERA_ENABLE_VERBOSE_LOGS
+	#define NAMICAMERA_ENABLE_VERBOSE_LOGS (!(UE_BUILD_SHIPPING || UE_BUILD_TEST))
+#endif
+
+/**
+ * 日志分类开关位
+ * 每个分类占两位：输出到 Log / 输出到屏幕
+ */
+enum class ENamiCameraLogFlag : uint32
+{
+	None                   = 0,
+	StackDebug             = 1 << 0,
+	Effect                 = 1 << 1,
+	EffectOnScreen         = 1 << 2,
+	StateCalculation       = 1 << 3,
+	StateCalculationOnScreen = 1 << 4,
+	Component              = 1 << 5,
+	ComponentOnScreen      = 1 << 6,
+	Warning                = 1 << 7,
+	WarningOnScreen        = 1 << 8,
+	CameraInfo             = 1 << 9,
+	CameraInfoOnScreen     = 1 << 10,
+	ModeBlend              = 1 << 11,
+	ModeBlendOnScreen      = 1 << 12,
+	InputInterrupt         = 1 << 13,
+	InputInterruptOnScreen = 1 << 14,
+};
+ENUM_CLASS_FLAGS(ENamiCameraLogFlag);
+
+/**
+ * 日志开关缓存
+ *
+ * 所有分类开关缓存在一个位掩码中，日志宏只读这一个整数，不再每次调用 GetDefault。
+ * 位掩码在以下时机重建：模块启动、设置 CDO 初始化/重载配置、编辑器内修改设置、控制台变量变化。
+ *
+ * 控制台变量 NamiCamera.Log.<分类>（Stack/Effect/State/Component/Warning/CameraInfo/ModeBlend/InputInterrupt）：
+ * -1 = 跟随项目设置（默认），0 = 关闭，1 = 仅 Log，2 = 仅屏幕，3 = Log + 屏幕
+ */
+struct NAMICAMERA_API FNamiCameraLogFlags
+{
+	/** 分类是否开启 */
+	static FORCEINLINE bool IsSet(ENamiCameraLogFlag Flag)
+	{
+		return (Mask & static_cast<uint32>(Flag)) != 0;
+	}
+
+	/** 从默认设置与控制台变量重建位掩码 */
+	static void Refresh();
+
+	/** 从指定设置对象与控制台变量重建位掩码（设置 CDO 初始化时使用） */
+	static void Refresh(const UNamiCameraSettings* Settings);
+
+private:
+	/** 当前开关位掩码 */
+	static uint32 Mask;
+};
@@ -0,0 +1,76 @@
+// Copyright Qiu, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 数学函数微基准结果（单个函数）
+ */
+struct NAMICAMERA_API FNamiCameraMathTimingResult
+{
+	FString Name;
+
+	/** 每轮调用次数 */
+	int32 Calls = 0;
+
+	/** 多轮中最快一轮与中位数的单次调用耗时（纳秒） */
+	double MinNsPerCall = 0.0;
+	double MedianNsPerCall = 0.0;
+
+	/** 序列化为单个 JSON 对象 */
+	FString ToJson() const;
+};
+
+/**
+ * 数学函数精度检查结果
+ */
+struct NAMICAMERA_API FNamiCameraMathAccuracyResult
+{
+	FString Name;
+
+	/** 积分帧率（与帧率无关的检查为 0） */
+	float FrameRate = 0.0f;
+
+	/** 相对参考解的最大误差（平滑类检查按初始距离归一化，角度类检查单位为度） */
+	double MaxError = 0.0;
+
+	/** 允许误差 */
+	double Tolerance = 0.0;
+
+	bool bPassed = false;
+
+	/** 序列化为单个 JSON 对象 */
+	FString ToJson() const;
+};
+
+/**
+ * FNamiCameraMath 微基准与精度检查
+ *
+ * 控制台命令：NamiCamera.MathBenchmark [Iterations=N] [Repeats=N] [SmoothTime=秒] [Out=文件路径]
+ *
+ * 计时：对每个函数用预生成的输入调用 Iterations 次，重复 Repeats 轮，输出每次调用的纳秒数。
+ * 精度：以 30/60/144/240 Hz 积分 1 秒，与双精度的指数逼近解 exp(-t/SmoothTime) 比较，
+ * 并检查终点在不同帧率之间的差异（帧率无关性）；角度归一化函数与双精度 fmod 结果比较；
+ * 缓动函数（FNamiCameraEasing）与 FMath::InterpEase* 逐点比较；
+ * 视图混合内核（FNamiCameraBlendKernel）在 2~6 层的随机混合栈上与逐层混合的结果比较；
+ * 由视图反推的参数空间状态（FNamiCameraState）经 ComputeOutput 与原视图比较。
+ * 结果写入 Saved/NamiCamera/MathBenchmark.json，供替换或向量化这些函数前后做比对。
+ */
+struct NAMICAMERA_API FNamiCameraMathBenchmark
+{
+	/** 精度检查使用的帧率 */
+	static constexpr float FrameRates[] = { 30.0f, 60.0f, 144.0f, 240.0f };
+
+	/** 运行计时 */
+	static void RunTimings(int32 Iterations, int32 Repeats, TArray<FNamiCameraMathTimingResult>& OutResults);
+
+	/**
+	 * 运行精度检查
+	 * @return 是否全部通过
+	 */
+	static bool RunAccuracyChecks(float SmoothTime, TArray<FNamiCameraMathAccuracyResult>& OutResults);
+
+	/** 将结果序列化为 JSON */
+	static FString ResultsToJson(const TArray<FNamiCameraMathTimingResult>& Timings, const TArray<FNamiCameraMathAccuracyResult>& Checks);
+};
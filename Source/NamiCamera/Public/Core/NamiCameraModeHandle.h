@@ -9,7 +9,7 @@ class UNamiCameraComponent;
 
 /**
  * 相机模式句柄
- * 用于标识和管理相机模式实例
+ * 用于标识和管理相机模式实例；记录优先级堆栈中的槽位与句柄 ID，条目移除后句柄自动失效
  */
 USTRUCT(BlueprintType)
 struct NAMICAMERA_API FNamiCameraModeHandle
@@ -17,7 +17,7 @@ struct NAMICAMERA_API FNamiCameraModeHandle
 	GENERATED_BODY()
 
 public:
-	/** 是否有效 */
+	/** 是否有效：所有者存活，且句柄对应的条目仍在其优先级堆栈中（条目移除、槽位被复用后返回 false） */
 	bool IsValid() const;
 
 	/** 重置句柄 */
@@ -31,8 +31,12 @@ private:
 	UPROPERTY()
 	TWeakObjectPtr<UNamiCameraComponent> Owner;
 
-	/** 句柄ID */
+	/** 句柄ID（由所有者组件生成，0 表示无效） */
 	UPROPERTY()
 	int32 HandleId = 0;
+
+	/** 优先级堆栈中的槽位 */
+	UPROPERTY()
+	int32 SlotIndex = INDEX_NONE;
 };
 
@@ -0,0 +1,77 @@
+// Copyright Qiu, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/NamiCameraModeStackEntry.h"
+#include <atomic>
+
+class UNamiCameraModeBase;
+
+/**
+ * 相机模式优先级堆栈
+ *
+ * 条目存放在带代数的槽位表中：句柄记录槽位与句柄 ID，查找只需比对槽位中的 ID，为 O(1)；
+ * 过期句柄（条目已移除、槽位被复用）因 ID 不匹配而失效。
+ * 同时维护按优先级升序排列的视图（栈顶为最后一个），推送/移除栈顶为 O(1)，其余位置二分定位。
+ * 句柄 ID 由每个堆栈独立的原子计数器生成，非零且单调递增，同优先级按 ID 先后排列。
+ */
+class NAMICAMERA_API FNamiCameraModePriorityStack
+{
+public:
+	/**
+	 * 推送条目（插入到同优先级条目之上）
+	 * @param OutSlotIndex 条目所在槽位
+	 * @return 句柄 ID
+	 */
+	int32 Push(UNamiCameraModeBase* CameraMode, int32 Priority, int32& OutSlotIndex);
+
+	/** 句柄对应条目在优先级视图中的索引（句柄过期时为 INDEX_NONE） */
+	int32 IndexOfHandle(int32 SlotIndex, int32 HandleId) const;
+
+	/** 句柄是否仍指向堆栈中的条目（只比对槽位中的 ID，O(1)） */
+	bool IsHandleAlive(int32 SlotIndex, int32 HandleId) const
+	{
+		return HandleId != 0 && Slots.IsValidIndex(SlotIndex) && Slots[SlotIndex].HandleId == HandleId;
+	}
+
+	/** 模式实例在优先级视图中的第一个索引（同一实例多次入栈时取数组中最前的条目） */
+	int32 IndexOfMode(const UNamiCameraModeBase* CameraMode) const;
+
+	/** 按优先级视图索引移除条目 */
+	void RemoveAt(int32 Index);
+
+	/** 清空（不重置句柄 ID 计数，旧句柄保持失效） */
+	void Empty();
+
+	/** 按优先级升序排列的条目（栈顶为最后一个） */
+	const TArray<FNamiCameraModeStackEntry>& GetEntries() const { return Entries; }
+
+	int32 Num() const { return Entries.Num(); }
+	bool IsValidIndex(int32 Index) const { return Entries.IsValidIndex(Index); }
+	const FNamiCameraModeStackEntry& Top() const { return Entries.Last(); }
+
+private:
+	/** 槽位：HandleId 为 0 表示空闲，空闲槽位经 NextFree 串成链表 */
+	struct FSlot
+	{
+		int32 HandleId = 0;
+		int32 Priority = 0;
+		int32 NextFree = INDEX_NONE;
+	};
+
+	/** 按 (Priority, HandleId) 二分查找条目在视图中的位置 */
+	int32 FindEntryIndex(int32 Priority, int32 HandleId) const;
+
+	/** 优先级视图 */
+	TArray<FNamiCameraModeStackEntry> Entries;
+
+	/** 槽位表 */
+	TArray<FSlot> Slots;
+
+	/** 空闲槽位链表头 */
+	int32 FirstFreeSlot = INDEX_NONE;
+
+	/** 句柄 ID 生成器 */
+	std::atomic<int32> NextHandleId{ 1 };
+};
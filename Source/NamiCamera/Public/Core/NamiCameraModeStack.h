@@ -4,10 +4,13 @@
 
 #include "CoreMinimal.h"
 #include "UObject/Object.h"
+#include "AlphaBlend.h"
+#include "Core/NamiCameraInertialization.h"
+#include "Core/NamiCameraState.h"
+#include "Core/NamiCameraView.h"
 #include "NamiCameraModeStack.generated.h"
 
 class UNamiCameraModeBase;
-struct FNamiCameraView;
 
 /**
  * 相机模式混合堆栈
@@ -20,6 +23,7 @@ struct NAMICAMERA_API FNamiCameraModeStack
 public:
 	/**
 	 * 推送相机模式到堆栈顶部
+	 * 模式的过渡方式为惯性化时，其余模式立即移出，切换偏移在之后的帧中衰减
 	 */
 	void PushCameraMode(UNamiCameraModeBase* CameraModeInstance);
 
@@ -27,9 +31,10 @@ public:
 	 * 评估堆栈并混合视图
 	 * @param DeltaTime 帧时间
 	 * @param OutCameraModeView 输出的混合视图
+	 * @param bTopModeOnly 是否只完整评估栈顶模式（帧预算降级时使用）
 	 * @return 是否有有效的相机模式
 	 */
-	bool EvaluateStack(float DeltaTime, FNamiCameraView& OutCameraModeView);
+	bool EvaluateStack(float DeltaTime, FNamiCameraView& OutCameraModeView, bool bTopModeOnly = false);
 
 	/**
 	 * 打印相机模式堆栈信息
@@ -41,24 +46,103 @@ public:
 	void DumpCameraModeStack(bool bPrintToScreen = true, bool bPrintToLog = true, 
 		FLinearColor TextColor = FLinearColor::Green, float Duration = 0.2f) const;
 
+	/**
+	 * 拷贝各模式的混合权重（索引 0 为栈顶）
+	 * @param OutWeights 输出缓冲，超出容量的模式被截断
+	 * @return 写入的权重数量
+	 */
+	int32 GetBlendWeights(TArrayView<float> OutWeights) const;
+
+	/**
+	 * 设置完整评估所需的最小有效贡献
+	 * 有效贡献低于该值的非栈顶模式只推进混合权重，跳过 CalculateView 与模式组件。0 = 始终完整评估
+	 */
+	void SetMinContribution(float InMinContribution) { MinContribution = InMinContribution; }
+
+	/**
+	 * 设置同时评估的模式数上限
+	 * 超出时最老的模式合并为一个冻结快照视图，快照作为栈底淡出且不再评估。0 = 不限制
+	 */
+	void SetMaxDepth(int32 InMaxDepth) { MaxDepth = FMath::Max(InMaxDepth, 0); }
+
+	/** 是否存在合并得到的冻结快照 */
+	bool HasCollapsedSnapshot() const { return bHasCollapsedSnapshot; }
+
+	/** 堆栈中的模式数量 */
+	int32 Num() const { return CameraModeStack.Num(); }
+
+	/** 堆栈中的模式（索引 0 为栈顶） */
+	const TArray<TObjectPtr<UNamiCameraModeBase>>& GetCameraModes() const { return CameraModeStack; }
+
 protected:
 	/**
 	 * 更新模式堆栈
 	 * @param DeltaTime 帧时间
+	 * @param bTopModeOnly 为 true 时非栈顶模式只推进混合权重，视图沿用上一帧
 	 * @return 是否有有效的相机模式
 	 */
-	bool UpdateStack(float DeltaTime);
+	bool UpdateStack(float DeltaTime, bool bTopModeOnly = false);
 
 	/**
 	 * 混合所有模式的视图
 	 * @param OutCameraModeView 输出的混合视图
 	 * @param DeltaTime 帧时间（用于PivotLocation计算）
 	 */
-	void BlendStack(FNamiCameraView& OutCameraModeView, float DeltaTime = 0.0f) const;
+	void BlendStack(FNamiCameraView& OutCameraModeView, float DeltaTime = 0.0f);
+
+	/**
+	 * 计算各模式在混合结果中的有效贡献（索引对应 CameraModeStack）
+	 * 栈底的贡献为自身权重，其余模式 = 自身权重 * 之下所有模式 (1 - 权重) 的乘积
+	 * 存在冻结快照时，快照视为权重为 CollapsedWeight 的最底层
+	 */
+	void ComputeContributions(TArray<float, TInlineAllocator<8>>& OutContributions) const;
+
+	/** 模式数超过上限时，将最老的模式合并进冻结快照 */
+	void EnforceMaxDepth();
+
+	/** 推进冻结快照的淡出，淡出完成后移除 */
+	void UpdateCollapsedSnapshot(float DeltaTime);
+
+	/** 移除冻结快照 */
+	void ClearCollapsedSnapshot();
 
 private:
 	/** 模式堆栈 */
 	UPROPERTY()
 	TArray<TObjectPtr<UNamiCameraModeBase>> CameraModeStack;
+
+	/** 完整评估所需的最小有效贡献 */
+	float MinContribution = 0.001f;
+
+	/** 同时评估的模式数上限，0 = 不限制 */
+	int32 MaxDepth = 0;
+
+	// ========== 冻结快照 ==========
+
+	/** 被合并模式在合并时刻的混合视图/状态，作为栈底参与混合 */
+	FNamiCameraView CollapsedView;
+	FNamiCameraState CollapsedState;
+
+	/** 快照权重（从合并时的等效权重淡出到 0） */
+	FAlphaBlend CollapsedBlend;
+	float CollapsedWeight = 0.0f;
+	bool bHasCollapsedSnapshot = false;
+
+	/** 参数空间混合结果（复用的输出缓冲） */
+	FNamiCameraState BlendedState;
+
+	// ========== 惯性化过渡 ==========
+
+	/** 最近两帧的输出视图与帧时间（惯性化过渡的源） */
+	FNamiCameraView LastOutputView;
+	FNamiCameraView PrevOutputView;
+	float LastOutputDeltaTime = 0.0f;
+	int32 NumOutputHistory = 0;
+
+	/** 推送惯性化模式后，在下一次评估时以新模式视图开始过渡 */
+	bool bPendingInertialization = false;
+	float PendingInertializationTime = 0.0f;
+
+	FNamiCameraInertializer Inertializer;
 };
 
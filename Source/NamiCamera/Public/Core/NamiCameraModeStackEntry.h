@@ -18,6 +18,9 @@ struct NAMICAMERA_API FNamiCameraModeStackEntry
 	/** 句柄ID */
 	int32 HandleId = 0;
 
+	/** 所在槽位 */
+	int32 SlotIndex = INDEX_NONE;
+
 	/** 优先级 */
 	int32 Priority = 0;
 
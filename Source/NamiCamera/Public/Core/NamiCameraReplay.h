@@ -0,0 +1,248 @@
+// Copyright Qiu, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Camera/CameraTypes.h"
+#include "Interfaces/NamiLockOnTargetProvider.h"
+#include "UObject/Object.h"
+#include "NamiCameraReplay.generated.h"
+
+class UNamiCameraAdjust;
+class UNamiCameraComponent;
+class UWorld;
+struct FNamiCameraAdjustLayer;
+
+/**
+ * 回放事件类型
+ */
+enum class ENamiCameraReplayEventType : uint8
+{
+	/** 推送相机模式（Class + Priority） */
+	PushMode,
+
+	/** 移除优先级堆栈中指定索引的模式（Index） */
+	PopMode,
+
+	/** 推送调整器（Class + Payload 为实例配置） */
+	PushAdjust,
+
+	/** 弹出调整器堆栈中指定索引的调整器（Index + bForceImmediate） */
+	PopAdjust,
+
+	/** 推送轻量调整层（Payload 为层配置 + 重复策略） */
+	PushLayer,
+
+	/** 弹出轻量层数组中指定索引的层（Index + bForceImmediate） */
+	PopLayer,
+};
+
+/**
+ * 回放事件（在所属帧的 GetCameraView 之前执行）
+ */
+struct NAMICAMERA_API FNamiCameraReplayEvent
+{
+	ENamiCameraReplayEventType Type = ENamiCameraReplayEventType::PushMode;
+
+	/** 模式或调整器类路径 */
+	FString ClassPath;
+
+	/** PushMode 为优先级，PopMode / PopAdjust / PopLayer 为堆栈索引，PushLayer 为重复策略 */
+	int32 Value = 0;
+
+	/** PopAdjust / PopLayer 是否立即移除 */
+	bool bForceImmediate = false;
+
+	/** PushLayer 为 FNamiCameraAdjustLayer 的导出文本，PushAdjust 为 FNamiCameraReplay::ExportAdjustConfig 的结果 */
+	FString Payload;
+};
+
+/**
+ * 单帧回放输入
+ * 覆盖相机管线每帧读取的全部外部输入
+ */
+struct NAMICAMERA_API FNamiCameraReplayFrame
+{
+	float DeltaTime = 0.0f;
+
+	/** 相机时间（秒），回放时注入，碰撞检测频率与遮挡检测间隔据此节流 */
+	double WorldTime = 0.0;
+
+	/** 所有者 Pawn 变换 */
+	FVector PawnLocation = FVector::ZeroVector;
+	FRotator PawnRotation = FRotator::ZeroRotator;
+
+	/** 帧开始时 PlayerController 的 ControlRotation */
+	FRotator ControlRotation = FRotator::ZeroRotator;
+
+	/** 原始鼠标增量（GetInputMouseDelta） */
+	FVector2D MouseDelta = FVector2D::ZeroVector;
+
+	/** 合并鼠标与摇杆后的视角输入（DetectPlayerCameraInput、LookSpeed 输入源读取） */
+	FVector2D LookInput = FVector2D::ZeroVector;
+
+	/** 锁定目标提供者状态 */
+	bool bHasLockedTarget = false;
+	FVector LockedLocation = FVector::ZeroVector;
+	FVector LockedFocusLocation = FVector::ZeroVector;
+
+	/** 本帧之前发生的堆栈事件 */
+	TArray<FNamiCameraReplayEvent> Events;
+};
+
+/**
+ * 回放文件
+ *
+ * 二进制格式（.ncrp）：魔数 'NCRP'、版本、相机组件类、初始模式堆栈、初始调整器、帧数据。
+ */
+struct NAMICAMERA_API FNamiCameraReplayFile
+{
+	static constexpr uint32 FileMagic = 0x5052434E; // 'NCRP'
+	static constexpr uint32 FileVersion = 5;
+
+	/** 初始模式（优先级堆栈顺序） */
+	struct FInitialMode
+	{
+		FString ClassPath;
+		int32 Priority = 0;
+	};
+
+	/** 初始调整器 */
+	struct FInitialAdjust
+	{
+		FString ClassPath;
+
+		/** FNamiCameraReplay::ExportAdjustConfig 的结果 */
+		FString Config;
+	};
+
+	/** 录制时的相机组件类（回放时用于创建同类组件） */
+	FString ComponentClassPath;
+
+	/** 开始录制时的模式堆栈 */
+	TArray<FInitialMode> InitialModes;
+
+	/** 开始录制时的调整器（调整器堆栈顺序） */
+	TArray<FInitialAdjust> InitialAdjusts;
+
+	/** 开始录制时的轻量调整层（层数组顺序，FNamiCameraAdjustLayer 的导出文本） */
+	TArray<FString> InitialLayers;
+
+	TArray<FNamiCameraReplayFrame> Frames;
+
+	/** 序列化头部（不含帧数据） */
+	void SerializeHeader(FArchive& Ar);
+
+	/** 序列化单帧 */
+	static void SerializeFrame(FArchive& Ar, FNamiCameraReplayFrame& Frame);
+
+	/** 从文件读取，失败时返回 false */
+	bool LoadFromFile(const FString& FilePath);
+};
+
+/**
+ * 相机回放录制器
+ *
+ * 录制期间逐帧追加到内存缓冲，停止时写入文件。
+ * 限制：模式按类重新创建，录制前对实例的运行时修改不会回放；
+ * 调整器按推送时（或开始录制时）的配置重建：与类默认值不同的可编辑属性及 SetStaticParams 设置的静态参数，
+ * 推送之后的修改与实例化子对象不会回放；
+ * 锁定目标只记录栈顶模式使用的提供者。
+ */
+class NAMICAMERA_API FNamiCameraReplayRecorder
+{
+public:
+	/** 开始录制，记录组件当前的模式与调整器堆栈 */
+	void Start(const UNamiCameraComponent& CameraComponent);
+
+	/** 停止录制并写入文件 */
+	bool Stop(const FString& FilePath);
+
+	/** 是否在录制 */
+	bool IsRecording() const { return bRecording; }
+
+	/** 记录堆栈事件（附加到下一帧） */
+	void RecordEvent(ENamiCameraReplayEventType Type, const UObject* ClassSource, int32 Value, bool bForceImmediate = false, FString Payload = FString());
+
+	/** 记录一帧输入（在 GetCameraView 开始时调用） */
+	void CaptureFrame(const UNamiCameraComponent& CameraComponent, float DeltaTime);
+
+private:
+	bool bRecording = false;
+
+	/** 头部信息（帧数组不使用） */
+	FNamiCameraReplayFile Header;
+
+	/** 已序列化的帧数据 */
+	TArray<uint8> FrameBuffer;
+	int32 NumFrames = 0;
+
+	/** 复用的帧对象与待写入事件（交换缓冲，稳态下不分配） */
+	FNamiCameraReplayFrame ScratchFrame;
+	TArray<FNamiCameraReplayEvent> PendingEvents;
+};
+
+/**
+ * 回放结果
+ */
+struct NAMICAMERA_API FNamiCameraReplayResult
+{
+	/** 每帧输出视图 */
+	TArray<FMinimalViewInfo> Views;
+
+	/** GetCameraView 累计耗时（秒，不含事件执行与输入注入） */
+	double PipelineSeconds = 0.0;
+
+	/** 将视图写为 CSV */
+	bool SaveViewsToCsv(const FString& FilePath) const;
+};
+
+/**
+ * 相机回放
+ *
+ * 控制台命令：
+ * - NamiCamera.Replay.Record Start|Stop [File=路径]：对所有相机组件开始/停止录制（默认写入 Saved/NamiCamera/Replay/）
+ * - NamiCamera.Replay.Play File=路径 [Out=CSV 路径] [Repeat=N]：在无头场景中回放并输出视图；
+ *   回放不限速，Repeat > 1 时作为吞吐基准并校验多次回放结果是否逐位一致
+ */
+struct NAMICAMERA_API FNamiCameraReplay
+{
+	/** 在世界中生成临时对象并回放，结束后销毁 */
+	static bool Run(UWorld* World, const FNamiCameraReplayFile& Replay, FNamiCameraReplayResult& OutResult);
+
+	/** 导出轻量调整层的配置（UPROPERTY 字段，对象引用按路径） */
+	static FString ExportLayer(const FNamiCameraAdjustLayer& Layer);
+
+	/** 从导出文本恢复轻量调整层的配置，失败时返回 false */
+	static bool ImportLayer(const FString& Text, FNamiCameraAdjustLayer& OutLayer);
+
+	/**
+	 * 导出调整器实例的配置：与类默认值不同的可编辑/蓝图可见属性（每行 名称=值），以及 SetStaticParams 设置的静态参数
+	 * 与类默认值不同的实例化子对象无法回放，记录警告后按类默认值处理
+	 */
+	static FString ExportAdjustConfig(const UNamiCameraAdjust& Adjust);
+
+	/** 将 ExportAdjustConfig 的结果应用到新建的调整器实例，失败的属性记录警告并返回 false */
+	static bool ImportAdjustConfig(const FString& Text, UNamiCameraAdjust& Adjust);
+};
+
+/**
+ * 回放用的锁定目标提供者，返回录制帧中的锁定状态
+ */
+UCLASS(Transient)
+class NAMICAMERA_API UNamiCameraReplayLockOnProvider : public UObject, public INamiLockOnTargetProvider
+{
+	GENERATED_BODY()
+
+public:
+	/** 当前帧数据 */
+	bool bHasLockedTarget = false;
+	FVector LockedLocation = FVector::ZeroVector;
+	FVector LockedFocusLocation = FVector::ZeroVector;
+
+	// ========== INamiLockOnTargetProvider ==========
+	virtual bool HasLockedTarget() const override { return bHasLockedTarget; }
+	virtual FVector GetLockedLocation() const override { return LockedLocation; }
+	virtual FVector GetLockedFocusLocation() const override { return LockedFocusLocation; }
+	// ========== End INamiLockOnTargetProvider ==========
+};
@@ -0,0 +1,100 @@
+// Copyright Qiu, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+
+class UWorld;
+struct FCollisionQueryParams;
+struct FCollisionShape;
+struct FHitResult;
+
+/**
+ * 场景查询优先级
+ */
+enum class ENamiCameraSceneQueryPriority : uint8
+{
+	/** 必须执行（如防穿墙碰撞），计入预算但从不推迟 */
+	Critical,
+
+	/** 超出预算时推迟到下一帧，调用方沿用上一次的结果 */
+	Deferrable,
+};
+
+/**
+ * 场景查询结果
+ */
+enum class ENamiCameraSceneQueryResult : uint8
+{
+	/** 已执行，无阻挡 */
+	Miss,
+
+	/** 已执行，有阻挡 */
+	Hit,
+
+	/** 超出预算被推迟，未执行 */
+	Deferred,
+};
+
+/**
+ * 相机场景查询代理
+ *
+ * 每个相机组件持有一个实例，相机管线内的射线/扫掠都经由它发起：
+ * 按帧统计扫掠与射线次数（同时写入 stat NamiCamera），并在超出预算时推迟可延迟的查询。
+ * 预算为每帧查询次数上限，0 表示不限制；控制台变量 NamiCamera.SceneQueryBudget >= 0 时覆盖组件设置。
+ * 仅在游戏线程使用。
+ */
+class NAMICAMERA_API FNamiCameraSceneQueryBroker
+{
+public:
+	/** 开始新的一帧，清空计数 */
+	void BeginFrame(int32 InBudget);
+
+	/** 结束当前帧，保存本帧计数供调试读取 */
+	void EndFrame();
+
+	/** 扫掠查询 */
+	ENamiCameraSceneQueryResult SweepSingleByChannel(const UWorld* World, FHitResult& OutHit,
+		const FVector& Start, const FVector& End, const FQuat& Rot, ECollisionChannel TraceChannel,
+		const FCollisionShape& CollisionShape, const FCollisionQueryParams& Params,
+		ENamiCameraSceneQueryPriority Priority = ENamiCameraSceneQueryPriority::Critical);
+
+	/** 射线查询 */
+	ENamiCameraSceneQueryResult LineTraceSingleByChannel(const UWorld* World, FHitResult& OutHit,
+		const FVector& Start, const FVector& End, ECollisionChannel TraceChannel,
+		const FCollisionQueryParams& Params,
+		ENamiCameraSceneQueryPriority Priority = ENamiCameraSceneQueryPriority::Deferrable);
+
+	/** 最近一帧的扫掠次数 */
+	int32 GetLastFrameSweeps() const { return LastSweeps; }
+
+	/** 最近一帧的射线次数 */
+	int32 GetLastFrameLineTraces() const { return LastLineTraces; }
+
+	/** 最近一帧被推迟的查询次数 */
+	int32 GetLastFrameDeferred() const { return LastDeferred; }
+
+	/** 最近一帧的总查询次数 */
+	int32 GetLastFrameQueries() const { return LastSweeps + LastLineTraces; }
+
+	/** 解析实际预算（控制台变量优先） */
+	static int32 ResolveBudget(int32 ComponentBudget);
+
+private:
+	/** 申请一次查询，超出预算的可延迟查询返回 false */
+	bool TryAcquire(ENamiCameraSceneQueryPriority Priority);
+
+	/** 本帧预算（0 = 不限制） */
+	int32 Budget = 0;
+
+	/** 本帧计数 */
+	int32 NumSweeps = 0;
+	int32 NumLineTraces = 0;
+	int32 NumDeferred = 0;
+
+	/** 最近一帧计数 */
+	int32 LastSweeps = 0;
+	int32 LastLineTraces = 0;
+	int32 LastDeferred = 0;
+};
@@ -7,6 +7,8 @@
 #include "Core/NamiCameraEnums.h"
 #include "NamiCameraState.generated.h"
 
+struct FNamiCameraView;
+
 /**
  * 相机状态
  * 
@@ -186,6 +188,14 @@ public:
 	 */
 	void LerpChanged(const FNamiCameraState& To, float Alpha, const FNamiCameraStateFlags& Mask);
 	
+	/**
+	 * 由世界空间视图反推输入参数
+	 * 吊臂由 PivotLocation 指向 CameraLocation，PivotRotation 取吊臂反方向，
+	 * 相机朝向与吊臂方向的差值记入 CameraRotationOffset；ComputeOutput 可还原该视图的相机位置与旋转。
+	 * 设置所有输入参数的修改标志，清除输出标志。
+	 */
+	void SetFromView(const FNamiCameraView& View);
+
 	/**
 	 * 重置为默认值
 	 */
@@ -4,6 +4,9 @@
 
 #include "CoreMinimal.h"
 #include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "UObject/Object.h"
+#include "UObject/Class.h"
 
 /**
  * NamiCamera 性能统计
@@ -20,6 +23,17 @@
  * - STAT_NamiCamera_CameraAdjust: 跟踪相机调整计算耗时
  * - STAT_NamiCamera_ModeComponents: 跟踪模式组件处理耗时
  * - STAT_NamiCamera_Smoothing: 跟踪相机平滑处理耗时
+ * - STAT_NamiCamera_PreProcess: 跟踪管线预处理耗时
+ * - STAT_NamiCamera_ControllerSync: 跟踪控制器同步耗时
+ * - STAT_NamiCamera_PostProcess: 跟踪管线后处理耗时
+ * - STAT_NamiCamera_ModeTick: 跟踪单个相机模式 Tick 耗时
+ * - STAT_NamiCamera_Calculators: 跟踪组合式模式计算器耗时
+ * - STAT_NamiCamera_Sweeps / LineTraces: 每帧相机发起的扫掠/射线查询次数
+ * - STAT_NamiCamera_DeferredQueries: 每帧超出场景查询预算被推迟的查询次数
+ * - STAT_NamiCamera_SkippedModeTicks: 每帧因贡献过低而跳过完整评估的模式数
+ * - STAT_NamiCamera_ReusedModeViews: 每帧因输入未变且已稳定而沿用上一次视图的模式数
+ * - STAT_NamiCamera_CollapsedModes: 每帧因超出模式栈深度上限而合并为冻结快照的模式数
+ * - STAT_NamiCamera_ModeStackCollapses: 启动以来模式栈合并的累计次数
  */
 
 // ============================================================================
@@ -48,6 +62,188 @@ DECLARE_CYCLE_STAT_EXTERN(TEXT("Mode Components"), STAT_NamiCamera_ModeComponent
 /** 相机平滑处理所花费的时间 */
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Smoothing"), STAT_NamiCamera_Smoothing, STATGROUP_NamiCamera, NAMICAMERA_API);
 
+/** 管线预处理（上下文构建）所花费的时间 */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Pre Process"), STAT_NamiCamera_PreProcess, STATGROUP_NamiCamera, NAMICAMERA_API);
+
+/** 控制器位置/旋转同步所花费的时间 */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Controller Sync"), STAT_NamiCamera_ControllerSync, STATGROUP_NamiCamera, NAMICAMERA_API);
+
+/** 管线后处理（调试绘制、应用变换）所花费的时间 */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Post Process"), STAT_NamiCamera_PostProcess, STATGROUP_NamiCamera, NAMICAMERA_API);
+
+/** 单个相机模式 Tick 所花费的时间 */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Mode Tick"), STAT_NamiCamera_ModeTick, STATGROUP_NamiCamera, NAMICAMERA_API);
+
+/** 组合式模式中计算器所花费的时间 */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Calculators"), STAT_NamiCamera_Calculators, STATGROUP_NamiCamera, NAMICAMERA_API);
+
+// ============================================================================
+// 计数统计
+// ============================================================================
+
+/** 每帧相机发起的扫掠查询次数 */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Sweeps"), STAT_NamiCamera_Sweeps, STATGROUP_NamiCamera, NAMICAMERA_API);
+
+/** 每帧相机发起的射线查询次数 */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Line Traces"), STAT_NamiCamera_LineTraces, STATGROUP_NamiCamera, NAMICAMERA_API);
+
+/** 每帧因超出场景查询预算而推迟的查询次数 */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Deferred Queries"), STAT_NamiCamera_DeferredQueries, STATGROUP_NamiCamera, NAMICAMERA_API);
+
+/** 每帧因有效贡献低于阈值（或帧预算降级）而只推进混合权重的模式数 */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Skipped Mode Ticks"), STAT_NamiCamera_SkippedModeTicks, STATGROUP_NamiCamera, NAMICAMERA_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Reused Mode Views"), STAT_NamiCamera_ReusedModeViews, STATGROUP_NamiCamera, NAMICAMERA_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Collapsed Modes"), STAT_NamiCamera_CollapsedModes, STATGROUP_NamiCamera, NAMICAMERA_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Mode Stack Collapses"), STAT_NamiCamera_ModeStackCollapses, STATGROUP_NamiCamera, NAMICAMERA_API);
+
+// ============================================================================
+// 分配审计（仅非 Shipping/Test）
+// ============================================================================
+
+#define NAMICAMERA_WITH_ALLOC_AUDIT (!(UE_BUILD_SHIPPING || UE_BUILD_TEST))
+
+/**
+ * 相机帧堆分配审计
+ *
+ * 控制台变量 NamiCamera.AllocAudit 1 开启后，统计 GetCameraView 各阶段的堆分配调用次数，
+ * 某帧发生分配时输出警告及分阶段明细（阶段计数为包含子阶段的累计值）。
+ * 计数来自 FMalloc 的全局调用计数，会混入同一时间段内其他线程的分配，建议在 -nullrhi 下解读。
+ */
+struct NAMICAMERA_API FNamiCameraAllocAudit
+{
+	/** 当前进程累计的堆分配调用次数（分配器未实现计数或 Shipping 下返回 0） */
+	static uint64 GetAllocationCallCount();
+
+#if NAMICAMERA_WITH_ALLOC_AUDIT
+	/** 审计是否开启 */
+	static bool IsEnabled();
+
+	/** 帧开始：清空分阶段计数 */
+	static void BeginFrame();
+
+	/** 帧结束：若本帧有分配则输出警告 */
+	static void EndFrame(const UObject* Context, uint64 FrameAllocs);
+
+	/** 记录一个阶段的分配次数 */
+	static void RecordStage(const TCHAR* StageName, uint64 StageAllocs);
+#endif
+};
+
+#if NAMICAMERA_WITH_ALLOC_AUDIT
+/** 阶段分配审计作用域 */
+struct FNamiCameraAllocAuditStageScope
+{
+	explicit FNamiCameraAllocAuditStageScope(const TCHAR* InStageName)
+		: StageName(InStageName)
+		, bActive(FNamiCameraAllocAudit::IsEnabled())
+		, StartCount(bActive ? FNamiCameraAllocAudit::GetAllocationCallCount() : 0)
+	{
+	}
+
+	~FNamiCameraAllocAuditStageScope()
+	{
+		if (bActive)
+		{
+			FNamiCameraAllocAudit::RecordStage(StageName, FNamiCameraAllocAudit::GetAllocationCallCount() - StartCount);
+		}
+	}
+
+private:
+	const TCHAR* StageName;
+	bool bActive;
+	uint64 StartCount;
+};
+
+/** 帧分配审计作用域（包裹整个 GetCameraView） */
+struct FNamiCameraAllocAuditFrameScope
+{
+	explicit FNamiCameraAllocAuditFrameScope(const UObject* InContext)
+		: Context(InContext)
+		, bActive(FNamiCameraAllocAudit::IsEnabled())
+		, StartCount(0)
+	{
+		if (bActive)
+		{
+			FNamiCameraAllocAudit::BeginFrame();
+			StartCount = FNamiCameraAllocAudit::GetAllocationCallCount();
+		}
+	}
+
+	~FNamiCameraAllocAuditFrameScope()
+	{
+		if (bActive)
+		{
+			FNamiCameraAllocAudit::EndFrame(Context, FNamiCameraAllocAudit::GetAllocationCallCount() - StartCount);
+		}
+	}
+
+private:
+	const UObject* Context;
+	bool bActive;
+	uint64 StartCount;
+};
+
+	#define NAMI_CAMERA_ALLOC_AUDIT_STAGE(StageName) \
+		FNamiCameraAllocAuditStageScope PREPROCESSOR_JOIN(NamiCameraAllocStage_, __LINE__)(StageName)
+	#define NAMI_CAMERA_ALLOC_AUDIT_FRAME(Context) \
+		FNamiCameraAllocAuditFrameScope PREPROCESSOR_JOIN(NamiCameraAllocFrame_, __LINE__)(Context)
+#else
+	#define NAMI_CAMERA_ALLOC_AUDIT_STAGE(StageName)
+	#define NAMI_CAMERA_ALLOC_AUDIT_FRAME(Context)
+#endif
+
+// ============================================================================
+// 作用域宏
+// ============================================================================
+
+/**
+ * 管线阶段作用域：同时开启循环统计与 Insights CPU 追踪事件
+ * 用法：NAMI_CAMERA_SCOPE_STAGE(ModeStack) 对应 STAT_NamiCamera_ModeStack
+ */
+#define NAMI_CAMERA_SCOPE_STAGE(StageName) \
+	SCOPE_CYCLE_COUNTER(STAT_NamiCamera_##StageName); \
+	TRACE_CPUPROFILER_EVENT_SCOPE(NamiCamera_##StageName); \
+	NAMI_CAMERA_ALLOC_AUDIT_STAGE(TEXT(#StageName))
+
+/**
+ * 对象追踪作用域
+ * 以对象类名命名的动态 Insights 事件，仅在 cpu 通道开启时才取类名，未开启追踪时无额外分配
+ */
+struct FNamiCameraObjectTraceScope
+{
+	explicit FNamiCameraObjectTraceScope(const UObject* Object)
+	{
+#if CPUPROFILERTRACE_ENABLED
+		if (Object && UE_TRACE_CHANNELEXPR_IS_ENABLED(CpuChannel))
+		{
+			FCpuProfilerTrace::OutputBeginDynamicEvent(*Object->GetClass()->GetName());
+			bActive = true;
+		}
+#endif
+	}
+
+	~FNamiCameraObjectTraceScope()
+	{
+#if CPUPROFILERTRACE_ENABLED
+		if (bActive)
+		{
+			FCpuProfilerTrace::OutputEndEvent();
+		}
+#endif
+	}
+
+private:
+	bool bActive = false;
+};
+
+/**
+ * 对象作用域：UObject 循环统计 + 以类名命名的 Insights 事件
+ * 用于模式、计算器、模式组件，便于在卡顿抓帧中定位具体类（包括蓝图类）
+ */
+#define NAMI_CAMERA_SCOPE_OBJECT(Object) \
+	SCOPE_CYCLE_UOBJECT(NamiCameraObject, Object); \
+	FNamiCameraObjectTraceScope PREPROCESSOR_JOIN(NamiCameraObjectScope_, __LINE__)(Object)
+
 // ============================================================================
 // 使用说明
 // ============================================================================
@@ -68,10 +264,17 @@ DECLARE_CYCLE_STAT_EXTERN(TEXT("Smoothing"), STAT_NamiCamera_Smoothing, STATGROU
  *    b) 在 NamiCameraStats.cpp 中定义：DEFINE_STAT(STAT_名称);
  *    c) 在代码中使用：SCOPE_CYCLE_COUNTER(STAT_名称);
  *
+ * 4. 管线阶段与对象作用域：
+ *    - NAMI_CAMERA_SCOPE_STAGE(阶段名)：循环统计 + Insights 事件（阶段名不含 STAT_NamiCamera_ 前缀）
+ *    - NAMI_CAMERA_SCOPE_OBJECT(对象)：以对象类名命名的动态事件，需开启 Insights cpu 通道查看
+ *
+ * 5. 分配审计：
+ *    - 控制台输入 NamiCamera.AllocAudit 1，稳定帧内发生堆分配时输出分阶段明细
+ *
  * 示例：
  *    void MyFunction()
  *    {
- *        SCOPE_CYCLE_COUNTER(STAT_NamiCamera_ModeStack);
+ *        NAMI_CAMERA_SCOPE_STAGE(ModeStack);
  *        // 你的代码...
  *    }
  */
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "ModeComponents/NamiCameraModeComponent.h"
 #include "Core/NamiCameraEnums.h"
+#include "Core/NamiCameraCurveCache.h"
 #include "NamiCameraEffectComponent.generated.h"
 
 /**
@@ -107,6 +108,9 @@ protected:
 	virtual void Update_Implementation(float DeltaTime) override;
 	virtual void ApplyToView_Implementation(FNamiCameraView& InOutView, float DeltaTime) override;
 
+	/** 效果按时间推进，激活期间不视为稳定 */
+	virtual bool IsSettled_Implementation() const override { return !bIsActive; }
+
 	// ========== 内部状态 ==========
 
 	/** 当前混合权重 */
@@ -133,6 +137,9 @@ protected:
 	/** 是否已保存原始视图 */
 	bool bHasSavedOriginalView = false;
 
+	/** BlendCurve 的共享查找表 */
+	FNamiCameraCurveLUTRef BlendCurveLUT;
+
 	// ========== 内部方法 ==========
 
 	/**
@@ -27,6 +27,9 @@ public:
 	virtual void Activate_Implementation() override;
 	virtual void Update_Implementation(float DeltaTime) override;
 
+	/** 锁定目标不在模式输入签名中：平滑位置追上焦点位置后才视为稳定 */
+	virtual bool IsSettled_Implementation() const override;
+
 	// ========== 锁定目标管理 ==========
 
 	/**
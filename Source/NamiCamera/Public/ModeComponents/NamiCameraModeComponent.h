@@ -5,10 +5,12 @@
 #include "CoreMinimal.h"
 #include "UObject/Object.h"
 #include "GameplayTagContainer.h"
+#include "Core/NamiCameraFrameBudget.h"
 #include "Core/NamiCameraView.h"
 #include "NamiCameraModeComponent.generated.h"
 
 class UNamiCameraModeBase;
+class FNamiCameraSceneQueryBroker;
 struct FNamiCameraPipelineContext;
 
 /**
@@ -86,6 +88,15 @@ public:
 		float DeltaTime,
 		UPARAM(ref) FNamiCameraPipelineContext& Context);
 
+	/**
+	 * 组件是否已稳定（模式沿用上一次视图的条件之一）
+	 * 模式输入未变时，稳定的组件再次执行应得到相同结果。
+	 * 无内部状态的组件、以及平滑状态会体现在模式输出中的组件（输出不再变化即视为收敛）保持默认 true；
+	 * 按时间推进的效果，或依赖模式输入签名之外的目标的组件应在未收敛时返回 false。
+	 */
+	UFUNCTION(BlueprintNativeEvent, BlueprintPure, Category = "Camera Mode Component")
+	bool IsSettled() const;
+
 	// ========== 辅助函数 ==========
 
 	/** 获取 World */
@@ -103,6 +114,15 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Camera Mode Component")
 	UNamiCameraModeBase* GetCameraMode() const { return CameraMode.Get(); }
 
+	/** 获取所属相机组件的场景查询代理（未挂在相机组件下时为空） */
+	FNamiCameraSceneQueryBroker* GetSceneQueryBroker() const;
+
+	/** 所属相机组件的帧预算降级是否达到指定等级（未挂在相机组件下时为 false） */
+	bool IsCameraDegraded(ENamiCameraDegradeLevel Level) const;
+
+	/** 相机时间（秒）：取自所属相机组件（回放时为录制时间），未挂在相机组件下时为 World 时间 */
+	double GetCameraTimeSeconds() const;
+
 	// ========== GameplayTags ==========
 
 	/** 添加 Tag */
@@ -33,10 +33,17 @@ public:
 	/**
 	 * 获取要忽略碰撞的 Actor 列表
 	 * 默认返回相机 Owner
+	 * 注意：仅当实例的原生类就是本类且蓝图未重写时，每帧直接走 CollectIgnoreActors 原生路径；
+	 * C++ 子类优先重写 CollectIgnoreActors（事件路径的默认实现同样调用它）
 	 */
 	UFUNCTION(BlueprintNativeEvent, Category = "Spring Arm")
 	TArray<AActor*> GetIgnoreActors() const;
 
+	/**
+	 * 收集要忽略碰撞的 Actor 到输出数组（不分配新数组）
+	 */
+	virtual void CollectIgnoreActors(TArray<AActor*>& OutIgnoreActors) const;
+
 public:
 	// ========== 配置 ==========
 
@@ -49,4 +56,10 @@ public:
 protected:
 	/** 是否已初始化 */
 	bool bSpringArmInitialized = false;
+
+	/** 是否需要经由 GetIgnoreActors 事件收集（蓝图重写或存在 C++ 子类，Initialize 时缓存） */
+	bool bUseIgnoreActorsEvent = false;
+
+	/** 忽略 Actor 复用缓冲 */
+	TArray<AActor*> IgnoreActorsBuffer;
 };
@@ -184,4 +184,7 @@ protected:
 
 	/** 命中的射线数量（用于计算部分遮挡） */
 	int32 OccludedRayCount = 0;
+
+	/** 本次遮挡检测是否因场景查询预算被推迟（推迟时保留上次结果，下一帧重试） */
+	bool bOcclusionCheckDeferred = false;
 };
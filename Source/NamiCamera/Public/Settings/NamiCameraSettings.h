@@ -6,6 +6,8 @@
 #include "Engine/DeveloperSettings.h"
 #include "NamiCameraSettings.generated.h"
 
+class UNamiCameraModeBase;
+
 /**
  * Nami相机系统设置
  * 可以在 Project Settings > Plugins > Nami Camera Settings 中配置
@@ -18,6 +20,14 @@ class NAMICAMERA_API UNamiCameraSettings : public UDeveloperSettings
 public:
 	UNamiCameraSettings(const FObjectInitializer& ObjectInitializer);
 
+	// ========== UObject 接口（设置变化时刷新日志开关缓存） ==========
+
+	virtual void PostInitProperties() override;
+	virtual void PostReloadConfig(FProperty* PropertyThatWasLoaded) override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
 	/** 是否启用相机模式堆栈Debug日志。勾选后会在屏幕上显示每个模式的混合权重、状态等信息，用于调试相机模式切换和混合过程。发布时建议关闭。 */
 	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Debug",
 		meta = (ToolTip = "是否在每帧打印相机模式堆栈的混合信息\n• 勾选后会在屏幕上显示每个模式的混合权重、状态等信息\n• 用于调试相机模式切换和混合过程\n• 发布时建议关闭"))
@@ -194,13 +204,21 @@ public:
 			ToolTip = "屏幕日志在屏幕上显示的颜色"))
 	FLinearColor OnScreenLogTextColor{FLinearColor::Green};
 
+	// ========== 预加载 ==========
+
+	/** 所有相机组件 BeginPlay 时异步加载并预热的相机模式 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Performance",
+		meta = (
+			ToolTip = "每个 NamiCameraComponent 在 BeginPlay 时异步加载这些相机模式类并预先创建、初始化实例\n• 与组件自身的 PreloadCameraModes 列表合并\n• 用于战斗中才会首次推送的模式，避免首次推送时卡顿"))
+	TArray<TSoftClassPtr<UNamiCameraModeBase>> PreloadCameraModes;
+
 	/** 获取设置实例 */
 	static const UNamiCameraSettings* Get();
 
 	/** 检查是否应该启用堆栈Debug日志 */
 	static bool ShouldEnableStackDebugLog();
 
-	// ========== 日志开关检查方法 ==========
+	// ========== 日志开关检查方法（读取 FNamiCameraLogFlags 缓存位掩码） ==========
 
 	/** 检查是否应该打印效果日志 */
 	static bool ShouldLogEffect();
@@ -278,5 +296,8 @@ public:
 
 	/** 获取屏幕日志文本颜色 */
 	static FLinearColor GetOnScreenLogTextColor();
+
+	/** 获取全局预加载的相机模式列表 */
+	static const TArray<TSoftClassPtr<UNamiCameraModeBase>>& GetPreloadCameraModes();
 };
 